@@ -1,11 +1,20 @@
 #pragma once
 
+#include <stdbool.h>
+
+#include "utils.h"
 #include "vm.h"
 
 // the domain analysis
 
 struct Symbol;typedef struct Symbol Symbol;
 
+typedef struct{		// a list of symbols linked by their "next" field
+	Symbol *first;		// the first symbol, NULL for an empty list
+	Symbol *last;		// the last symbol, NULL for an empty list
+	int n;		// the number of symbols in list
+	}SymbolList;
+
 typedef enum{		// base type
 	TB_INT,TB_DOUBLE,TB_CHAR,TB_VOID,TB_STRUCT
 	}TypeBase;
@@ -21,15 +30,20 @@ typedef struct{		// the type of a symbol
 	int n;
 	}Type;
 
-// returns the size of type t in bytes
+// returns the size of type t in bytes, including the padding of structs
+// t must not be larger than INT_MAX bytes, which typeSizeLong can verify
 int typeSize(Type *t);
+// returns the size of type t in bytes, computed without overflow
+long long typeSizeLong(Type *t);
+// returns the alignment of type t in bytes, the same as the C compiler for this platform uses
+int typeAlign(Type *t);
 
 typedef enum{		// symbol's kind
 	SK_VAR,SK_PARAM,SK_FN,SK_STRUCT
 	}SymKind;
 
 struct Symbol{
-	const char *name;		// symbol's name. The symbol doesn't own this pointer, but it is allocated somewhere else (ex: in Token)
+	const char *name;		// symbol's name, interned (see intern.h), so names are compared by pointer. The symbol doesn't own this pointer
 	SymKind kind;
 	Type type;
 
@@ -39,59 +53,103 @@ struct Symbol{
 	//		- a function for parameters/variables local to that function
 	Symbol *owner;
 	Symbol *next;		// the link to the next symbol in list
+	// for the global symbols defined in the unit, the index of the token where they were defined
+	// a function body sees only the symbols defined before it, even if it is compiled after them
+	int defIdx;
 	union{		// specific data fo each kind of symbol
 		// the index in fn.locals for local vars
-		// the index in struct for struct members
+		// the offset in struct for struct members, aligned for their type
 		int varIdx;
-		// the variable memory for global vars (dynamically allocated)
-		void *varMem;
+		// the offset of the memory of global vars in globalsMem
+		int varOffset;
 		// the index in fn.params for parameters
 		int paramIdx;
-		// the members of a struct
-		Symbol *structMembers;
 		struct{
-			Symbol *params;		// the parameters of a function
-			Symbol *locals;		// all local vars of a function, including the ones from its inner domains
+			SymbolList structMembers;		// the members of a struct
+			// the size of a struct, which is kept while its members are added, so typeSize
+			// doesn't sum the members again
+			int structSize;
+			int structAlign;		// the largest alignment of the members of a struct
+			};
+		struct{
+			SymbolList params;		// the parameters of a function
+			SymbolList locals;		// all local vars of a function, including the ones from its inner domains
 			void(*extFnPtr)();		// !=NULL for extern functions
-			Instr *instr;		// used if extFnPtr==NULL
+			InstrList instr;		// used if extFnPtr==NULL
 			}fn;
 		};
 	};
 
 // dynamically allocation of a new symbol
+// all the names given to the symbols functions must be interned (see intern.h)
 Symbol *newSymbol(const char *name,SymKind kind);
-// duplicates the given symbol
-Symbol *dupSymbol(Symbol *symbol);
 // adds the symbol the the end of the list
 // list - the address of the list where to add the symbol
-Symbol *addSymbolToList(Symbol **list,Symbol *s);
-// the number of the symbols in list
-int symbolsLen(Symbol *list);
+Symbol *addSymbolToList(SymbolList *list,Symbol *s);
+// adds the member m at the end of struct s, at the first offset aligned for its type
+// the size of s is not padded, so more members can be added
+Symbol *addStructMember(Symbol *s,Symbol *m);
+// returns true if a member of type t can be added to struct s, so its padded size fits in an int
+bool structMemberFits(Symbol *s,Type *t);
+// pads the size of struct s to a multiple of its alignment, after all its members were added,
+// so the members of all the elements of an array of s are aligned
+void endStruct(Symbol *s);
 // frees the memory of a symbol
 void freeSymbol(Symbol *s);
-
+// frees all the symbols from list and empties it
+void freeSymbols(SymbolList *list);
+
+// A domain and its arrays are allocated in a region of the arena of its thread,
+// which is released when the domain is dropped.
+// The domain owns only its symbols without an owner. The local variables, the parameters
+// and the struct members are owned by the lists of their owner, so they are kept after
+// their domain is dropped.
 typedef struct _Domain{
 	struct _Domain *parent;		// the parent domain
-	Symbol *symbols;		// the symbols from this domain (single linked list)
+	Symbol **symbols;		// the symbols from this domain, in the order of their definition
+	int nSymbols;
+	int capSymbols;
+	// the symbols indexed by name in an open addressing hash table, NULL while the domain is
+	// small enough to be searched in its array (see DOMAIN_LIST_MAX)
+	Symbol **slots;
+	int nSlots;		// a power of 2, at least twice nSymbols
+	ArenaMark mark;		// the domains arena before the domain was pushed
+	int globalsMark;		// the size of globalsMem before the domain was pushed
 	}Domain;
 
 // the current domain (the top of the domains's stack)
-extern Domain *symTable;
+// each thread has its own stack, which can start from a shared domain
+extern _Thread_local Domain *symTable;
 
 // adds a domain to the top of the domains's stack
 Domain *pushDomain();
 // deletes the domain from the top of the domains's stack
 void dropDomain();
+// frees the memory kept for the domains of the current thread, after all of them were dropped
+void domainsRelease();
 // shows the content of the given domain
 void showDomain(Domain *d,const char *name);
 // search a symbol with the given name in the specified domain and returns it
 // if no symbol find, returns NULL
+// the names are atoms, so they are found by their atomHash
 Symbol *findSymbolInDomain(Domain *d,const char *name);
 // searches a symbol in all domains, starting with the current one
 Symbol *findSymbol(const char *name);
-// adds a symbol to the current domain
+// adds a symbol to the end of the domain d, which must be the top of the stack
+// s is not linked in a list, so it can be also in the list of its owner
 Symbol *addSymbolToDomain(Domain *d,Symbol *s);
 
+// The memory of all the global variables, in a segment which is reserved when the first one
+// is allocated. Its pages take physical memory only when they are used, so the global arrays
+// which are not used don't take memory.
+// The globals are allocated only by the main thread, while the domain of the unit is on the stack.
+extern char *globalsMem;
+
+// allocs in globalsMem the memory of a global variable of type t, aligned for t and zeroed
+// the memory is freed when the current domain is dropped
+// returns its offset in globalsMem, or -1 if there is no more room for it
+int allocGlobal(Type *t);
+
 // add in ST an extern function with the given name, address and return type
 Symbol *addExtFn(const char *name,void(*extFnPtr)(),Type ret);
 
@@ -2,11 +2,21 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <limits.h>
 
 #include "utils.h"
+#include "intern.h"
 #include "ad.h"
 
-Domain *symTable=NULL;
+_Thread_local Domain *symTable=NULL;
+// the memory of the domains of the thread, as a stack of regions
+_Thread_local Arena domainsArena=ARENA_INIT;
+
+// the address space reserved for globalsMem, so the offsets of the globals fit in an int
+#define GLOBALS_MAX_SIZE ((size_t)INT_MAX+1)
+
+char *globalsMem=NULL;
+int globalsSize=0;		// the used part of globalsMem
 
 int typeBaseSize(Type *t){
 	switch(t->tb){
@@ -14,28 +24,45 @@ int typeBaseSize(Type *t){
 		case TB_DOUBLE:return sizeof(double);
 		case TB_CHAR:return sizeof(char);
 		case TB_VOID:return 0;
-		default:{		// TB_STRUCT
-			int size=0;
-			for(Symbol *m=t->s->structMembers;m;m=m->next){
-				size+=typeSize(&m->type);
-				}
-			return size;
-			}
+		default:		// TB_STRUCT
+			return t->s->structSize;
 		}
 	}
 
-int typeSize(Type *t){
+long long typeSizeLong(Type *t){
 	if(t->n<0)return typeBaseSize(t);
 	if(t->n==0)return sizeof(void*);
-	return t->n*typeBaseSize(t);
+	return (long long)t->n*typeBaseSize(t);
+	}
+
+int typeSize(Type *t){
+	return (int)typeSizeLong(t);
+	}
+
+int typeAlign(Type *t){
+	if(t->n==0)return _Alignof(void*);		// an array without dimension is passed by its address
+	switch(t->tb){
+		case TB_INT:return _Alignof(int);
+		case TB_DOUBLE:return _Alignof(double);
+		case TB_CHAR:return _Alignof(char);
+		case TB_VOID:return 1;
+		default:		// TB_STRUCT
+			return t->s->structAlign?t->s->structAlign:1;		// an empty struct has no members to align
+		}
+	}
+
+// rounds offset up to a multiple of align
+int alignUp(int offset,int align){
+	return (offset+align-1)/align*align;
 	}
 
 // free from memory a list of symbols
-void freeSymbols(Symbol *list){
-	for(Symbol *next;list;list=next){
-		next=list->next;
-		freeSymbol(list);
+void freeSymbols(SymbolList *list){
+	for(Symbol *s=list->first,*next;s;s=next){
+		next=s->next;
+		freeSymbol(s);
 		}
+	*list=(SymbolList){NULL,NULL,0};
 	}
 
 Symbol *newSymbol(const char *name,SymKind kind){
@@ -47,50 +74,57 @@ Symbol *newSymbol(const char *name,SymKind kind){
 	return s;
 	}
 
-Symbol *dupSymbol(Symbol *symbol){
-	Symbol *s=(Symbol*)safeAlloc(sizeof(Symbol));
-	*s=*symbol;
-	s->next=NULL;
-	return s;
-	}
-
 // s->next is already NULL from newSymbol
-Symbol *addSymbolToList(Symbol **list,Symbol *s){
-	Symbol *iter=*list;
-	if(iter){
-		while(iter->next)iter=iter->next;
-		iter->next=s;
+Symbol *addSymbolToList(SymbolList *list,Symbol *s){
+	if(list->last){
+		list->last->next=s;
 		}else{
-		*list=s;
+		list->first=s;
 		}
+	list->last=s;
+	list->n++;
 	return s;
 	}
 
-int symbolsLen(Symbol *list){
-	int n=0;
-	for(;list;list=list->next)n++;
-	return n;
+Symbol *addStructMember(Symbol *s,Symbol *m){
+	int align=typeAlign(&m->type);
+	m->varIdx=alignUp(s->structSize,align);
+	s->structSize=m->varIdx+typeSize(&m->type);
+	if(align>s->structAlign)s->structAlign=align;
+	return addSymbolToList(&s->structMembers,m);
+	}
+
+bool structMemberFits(Symbol *s,Type *t){
+	long long align=typeAlign(t);
+	long long structAlign=align>s->structAlign?align:s->structAlign;
+	long long end=(s->structSize+align-1)/align*align+typeSizeLong(t);
+	return (end+structAlign-1)/structAlign*structAlign<=INT_MAX;
+	}
+
+void endStruct(Symbol *s){
+	s->structSize=alignUp(s->structSize,typeAlign(&s->type));
 	}
 
 void freeSymbol(Symbol *s){
 	switch(s->kind){
-		case SK_VAR:
-			if(!s->owner)free(s->varMem);
-			break;
 		case SK_FN:
-			freeSymbols(s->fn.params);
-			freeSymbols(s->fn.locals);
+			freeSymbols(&s->fn.params);
+			freeSymbols(&s->fn.locals);
+			instrRollback(&s->fn.instr,NULL);
 			break;
 		case SK_STRUCT:
-			freeSymbols(s->structMembers);
+			freeSymbols(&s->structMembers);
 			break;
 		}
 	free(s);
 	}
 
 Domain *pushDomain(){
-	Domain *d=(Domain*)safeAlloc(sizeof(Domain));
-	d->symbols=NULL;
+	ArenaMark mark=arenaMark(&domainsArena);
+	Domain *d=(Domain*)arenaAlloc(&domainsArena,sizeof(Domain));
+	memset(d,0,sizeof(Domain));
+	d->mark=mark;
+	d->globalsMark=globalsSize;
 	d->parent=symTable;
 	symTable=d;
 	return d;
@@ -99,8 +133,30 @@ Domain *pushDomain(){
 void dropDomain(){
 	Domain *d=symTable;
 	symTable=d->parent;
-	freeSymbols(d->symbols);
-	free(d);
+	for(int i=0;i<d->nSymbols;i++){
+		if(!d->symbols[i]->owner)freeSymbol(d->symbols[i]);
+		}
+	// the other threads don't allocate globals, so they never write globalsSize
+	if(globalsSize>d->globalsMark){
+		zeroMemory(globalsMem+d->globalsMark,globalsSize-d->globalsMark);
+		globalsSize=d->globalsMark;
+		}
+	arenaRelease(&domainsArena,d->mark);
+	}
+
+int allocGlobal(Type *t){
+	if(!globalsMem)globalsMem=(char*)reserveMemory(GLOBALS_MAX_SIZE);
+	size_t align=typeAlign(t);
+	size_t offset=(globalsSize+align-1)/align*align;
+	size_t size=typeSize(t);
+	if(offset+size>GLOBALS_MAX_SIZE-1)return -1;
+	commitMemory(globalsMem+offset,size);
+	globalsSize=(int)(offset+size);
+	return (int)offset;
+	}
+
+void domainsRelease(){
+	arenaFree(&domainsArena);
 	}
 
 void showNamedType(Type *t,const char *name){
@@ -121,10 +177,12 @@ void showSymbol(Symbol *s){
 	switch(s->kind){
 			case SK_VAR:
 				showNamedType(&s->type,s->name);
-				if(s->owner){
+				if(s->owner&&s->owner->kind==SK_STRUCT){
+					printf(";\t// size=%d, align=%d, offset=%d\n",typeSize(&s->type),typeAlign(&s->type),s->varIdx);
+					}else if(s->owner){
 					printf(";\t// size=%d, idx=%d\n",typeSize(&s->type),s->varIdx);
 					}else{
-					printf(";\t// size=%d, mem=%p\n",typeSize(&s->type),s->varMem);
+					printf(";\t// size=%d, mem=%p\n",typeSize(&s->type),globalsMem+s->varOffset);
 					}
 				break;
 			case SK_PARAM:{
@@ -135,13 +193,13 @@ void showSymbol(Symbol *s){
 				showNamedType(&s->type,s->name);
 				printf("(");
 				bool next=false;
-				for(Symbol *param=s->fn.params;param;param=param->next){
+				for(Symbol *param=s->fn.params.first;param;param=param->next){
 					if(next)printf(", ");
 					showSymbol(param);
 					next=true;
 					}
 				printf("){\n");
-				for(Symbol *local=s->fn.locals;local;local=local->next){
+				for(Symbol *local=s->fn.locals.first;local;local=local->next){
 					printf("\t");
 					showSymbol(local);
 					}
@@ -149,26 +207,41 @@ void showSymbol(Symbol *s){
 				}break;
 			case SK_STRUCT:{
 				printf("struct %s{\n",s->name);
-				for(Symbol *m=s->structMembers;m;m=m->next){
+				int end=0;		// the end of the previous member, to show the padding after it
+				for(Symbol *m=s->structMembers.first;m;m=m->next){
+					if(m->varIdx>end)printf("\t// padding=%d\n",m->varIdx-end);
 					printf("\t");
 					showSymbol(m);
+					end=m->varIdx+typeSize(&m->type);
 					}
-				printf("\t};\t// size=%d\n",typeSize(&s->type));
+				if(s->structSize>end)printf("\t// padding=%d\n",s->structSize-end);
+				printf("\t};\t// size=%d, align=%d\n",typeSize(&s->type),typeAlign(&s->type));
 				}break;
 		}
 	}
 
 void showDomain(Domain *d,const char *name){
 	printf("// domain: %s\n",name);
-	for(Symbol *s=d->symbols;s;s=s->next){
-		showSymbol(s);
+	for(int i=0;i<d->nSymbols;i++){
+		showSymbol(d->symbols[i]);
 		}
 	puts("\n");
 	}
 
+// a domain with at most this number of symbols has no hash table, because
+// most domains are blocks with a few local variables
+#define DOMAIN_LIST_MAX 8
+
 Symbol *findSymbolInDomain(Domain *d,const char *name){
-	for(Symbol *s=d->symbols;s;s=s->next){
-		if(!strcmp(s->name,name))return s;
+	if(d->slots){
+		unsigned mask=d->nSlots-1;
+		for(unsigned i=atomHash(name)&mask;d->slots[i];i=(i+1)&mask){
+			if(d->slots[i]->name==name)return d->slots[i];
+			}
+		return NULL;
+		}
+	for(int i=0;i<d->nSymbols;i++){
+		if(d->symbols[i]->name==name)return d->symbols[i];
 		}
 	return NULL;
 	}
@@ -181,8 +254,40 @@ Symbol *findSymbol(const char *name){
 	return NULL;
 	}
 
+// adds s in the hash table of d, after the symbols with the same hash
+void addToSlots(Domain *d,Symbol *s){
+	unsigned mask=d->nSlots-1;
+	unsigned i=atomHash(s->name)&mask;
+	while(d->slots[i])i=(i+1)&mask;
+	d->slots[i]=s;
+	}
+
+// rebuilds the hash table of d with nSlots slots, in the order of the symbols,
+// so the first of two symbols with the same name is found, as in the array
+// the old table stays in the arena until the domain is dropped
+void resizeSlots(Domain *d,int nSlots){
+	d->slots=(Symbol**)arenaAlloc(&domainsArena,nSlots*sizeof(Symbol*));
+	memset(d->slots,0,nSlots*sizeof(Symbol*));
+	d->nSlots=nSlots;
+	for(int i=0;i<d->nSymbols;i++)addToSlots(d,d->symbols[i]);
+	}
+
 Symbol *addSymbolToDomain(Domain *d,Symbol *s){
-	return addSymbolToList(&d->symbols,s);
+	if(d->nSymbols==d->capSymbols){
+		int cap=d->capSymbols?d->capSymbols*2:DOMAIN_LIST_MAX;
+		Symbol **symbols=(Symbol**)arenaAlloc(&domainsArena,cap*sizeof(Symbol*));
+		if(d->nSymbols)memcpy(symbols,d->symbols,d->nSymbols*sizeof(Symbol*));
+		d->symbols=symbols;
+		d->capSymbols=cap;
+		}
+	d->symbols[d->nSymbols++]=s;
+	if(d->slots){
+		if(2*d->nSymbols>d->nSlots)resizeSlots(d,2*d->nSlots);
+		else addToSlots(d,s);
+		}else if(d->nSymbols>DOMAIN_LIST_MAX){
+		resizeSlots(d,4*DOMAIN_LIST_MAX);
+		}
+	return s;
 	}
 
 Symbol *addExtFn(const char *name,void(*extFnPtr)(),Type ret){
@@ -196,7 +301,8 @@ Symbol *addExtFn(const char *name,void(*extFnPtr)(),Type ret){
 Symbol *addFnParam(Symbol *fn,const char *name,Type type){
 	Symbol *param=newSymbol(name,SK_PARAM);
 	param->type=type;
-	param->paramIdx=symbolsLen(fn->fn.params);
-	addSymbolToList(&fn->fn.params,dupSymbol(param));
+	param->owner=fn;
+	param->paramIdx=fn->fn.params.n;
+	addSymbolToList(&fn->fn.params,param);
 	return param;
 	}
@@ -1,5 +1,43 @@
 #pragma once
 
+#include <stdbool.h>
+
 #include "lexer.h"
 
-void parse(Token *tokens);
+#define MAX_DIAGNOSTICS 100 // the parsing stops after this number of errors
+
+// an error found while parsing
+typedef struct {
+  int line;
+  char text[256];
+} Diagnostic;
+
+// the errors from the last parse, in the order in which they were found
+// each thread has its own errors, see parseParallel
+extern _Thread_local Diagnostic diagnostics[MAX_DIAGNOSTICS];
+extern _Thread_local int nDiagnostics;
+
+// parses all the tokens from the array returned by tokenize
+// returns true if there are no errors, else the errors are in diagnostics
+bool parse(Token *tokens);
+
+// like parse, but compiles the function bodies on up to nThreads threads,
+// after the other definitions were parsed
+// if there are errors, the tokens are parsed again by parse, so the errors
+// are the same
+bool parseParallel(Token *tokens, int nThreads);
+
+// compiles a new version of the unit compiled by the last reparse, like
+// parseParallel; the unit is kept in the symbols table, with the code of its
+// functions, until the next reparse
+// if only some function bodies changed, only they are compiled again and the
+// calls to them don't change; else, or if the previous version had errors,
+// the whole unit is compiled again
+// tokens must be kept until the next reparse
+// *nCompiled is set to the number of compiled function bodies
+bool reparse(Token *tokens, int nThreads, int *nCompiled);
+
+// parses the tokens read on demand from lx, so only a window of tokens is
+// kept in memory while parsing
+// returns true if there are no errors, else the errors are in diagnostics
+bool parseStream(Lexer *lx);
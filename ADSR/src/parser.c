@@ -1,8 +1,11 @@
+#include <limits.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "ad.h"
 #include "at.h"
@@ -11,54 +14,345 @@
 #include "utils.h"
 #include "vm.h"
 
-Token *iTk = NULL;        // the iterator in the tokens list
-Token *consumedTk = NULL; // the last consumed token
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
 
-Symbol *owner = NULL;
+// The state of the parser is kept by each thread, so the function bodies can
+// be compiled in parallel (see parseParallel).
 
+// all the tokens, when the whole input was tokenized
+_Thread_local Token *tokens = NULL;
+// else, the lexer from which the tokens are read
+_Thread_local Lexer *lexer = NULL;
+
+_Thread_local int iTk = 0;              // the index of the current token
+_Thread_local Token *consumedTk = NULL; // the last consumed token
+
+// returns the token with the given index
+Token *tokenAt(int idx) {
+  return lexer ? lexerToken(lexer, idx) : &tokens[idx];
+}
+
+_Thread_local Symbol *owner = NULL;
+
+// the global symbols defined from this token on are not visible, because
+// they are defined after the function body compiled by the thread
+_Thread_local int visibleUntil = INT_MAX;
+
+// findSymbol, for the symbols visible from the current token
+Symbol *findVisibleSymbol(const char *name) {
+  Symbol *s = findSymbol(name);
+  return s && s->defIdx < visibleUntil ? s : NULL;
+}
+
+// The parser is predictive: each rule is selected from the next tokens
+// (at most 4, see the FIRST sets in rules.ipynb), so it never goes back to
+// an already consumed token. A rule returns false only if it consumed
+// nothing, else it succeeds or reports an error.
+
+_Thread_local int nConsumed = 0; // the number of successful consume calls
+
+#ifdef PARSER_STATS
+#ifndef __GNUC__
+#error "PARSER_STATS needs the cleanup attribute of GCC or Clang"
+#endif
+// Optional instrumentation of the grammar rules: each rule starts with
+// RULE_STATS, which counts its calls, the calls which found it (consumed
+// tokens) and the calls left by an error. The tokens consumed, the AST nodes
+// built and the time are counted for the innermost rule being parsed, so
+// they don't include the rules which it calls. The tokens skipped after an
+// error are counted for the rule whose recovery point skipped them. The
+// parser is predictive, so it never consumes again a token which it has
+// already consumed: such tokens are counted as backtracked, which must stay 0.
+// The counts of all the threads are printed at exit, sorted by time.
+
+#define PARSER_RULES(X)                                                        \
+  X(unit)                                                                      \
+  X(structDef)                                                                 \
+  X(globalVarDef)                                                              \
+  X(varDef)                                                                    \
+  X(typeBase)                                                                  \
+  X(arrayDecl)                                                                 \
+  X(fnDef)                                                                     \
+  X(fnParam)                                                                   \
+  X(fnBody)                                                                    \
+  X(stmCompound)                                                               \
+  X(stmRule)                                                                   \
+  X(expr)                                                                      \
+  X(exprPostfix)                                                               \
+  X(exprPrimary)                                                               \
+  X(exprPostfixPrim)
+
+#define RULE_ID(name) RULE_##name,
+typedef enum { PARSER_RULES(RULE_ID) N_RULES } RuleId;
+#define RULE_NAME(name) #name,
+const char *ruleNames[N_RULES] = {PARSER_RULES(RULE_NAME)};
 
 typedef struct {
-  Instr *startInstr;
-  Token *guardedToken;
-} Guard;
+  long long calls;
+  long long found;   // the calls which consumed tokens
+  long long errors;  // the calls left by an error
+  long long tokens;  // the tokens consumed directly by the rule
+  long long skipped; // the tokens skipped by its recovery point
+  long long nodes;   // the AST nodes built directly by the rule
+  long long ns;      // the time spent directly in the rule
+  long long backtracked; // the tokens consumed again by the rule
+} RuleStats;
+
+_Thread_local RuleStats ruleStats[N_RULES];
+RuleStats totalStats[N_RULES]; // the counts of the threads which finished
+#ifndef _WIN32
+pthread_mutex_t totalStatsLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+// the rules being parsed by the thread, the innermost last
+_Thread_local RuleId *activeRules = NULL;
+_Thread_local int nActiveRules = 0, capActiveRules = 0;
+_Thread_local long long lastRuleNs = 0; // when the innermost rule changed
+_Thread_local bool skippingTokens = false;
+// the index after the last token consumed since the parsing started from a
+// new position (a unit or a function body)
+_Thread_local int endConsumedTk = 0;
+
+long long nowNs() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// adds the time since the innermost rule changed to that rule
+void chargeRule() {
+  long long now = nowNs();
+  if (nActiveRules > 0) {
+    ruleStats[activeRules[nActiveRules - 1]].ns += now - lastRuleNs;
+  }
+  lastRuleNs = now;
+}
+
+// adds the counts of the current thread to totalStats
+void mergeRuleStats() {
+#ifndef _WIN32
+  pthread_mutex_lock(&totalStatsLock);
+#endif
+  for (int i = 0; i < N_RULES; i++) {
+    RuleStats *t = &totalStats[i], *s = &ruleStats[i];
+    t->calls += s->calls;
+    t->found += s->found;
+    t->errors += s->errors;
+    t->tokens += s->tokens;
+    t->skipped += s->skipped;
+    t->nodes += s->nodes;
+    t->ns += s->ns;
+    t->backtracked += s->backtracked;
+  }
+#ifndef _WIN32
+  pthread_mutex_unlock(&totalStatsLock);
+#endif
+  memset(ruleStats, 0, sizeof(ruleStats));
+  free(activeRules);
+  activeRules = NULL;
+  nActiveRules = capActiveRules = 0;
+}
+
+int compareRuleTimes(const void *a, const void *b) {
+  long long nsA = totalStats[*(const int *)a].ns;
+  long long nsB = totalStats[*(const int *)b].ns;
+  return nsA < nsB ? 1 : nsA > nsB ? -1 : 0;
+}
+
+void printRuleStats() {
+  mergeRuleStats();
+  int order[N_RULES];
+  for (int i = 0; i < N_RULES; i++) {
+    order[i] = i;
+  }
+  qsort(order, N_RULES, sizeof(int), compareRuleTimes);
+  fprintf(stderr, "%-16s %10s %10s %8s %10s %8s %10s %10s %11s\n", "rule",
+          "calls", "found", "errors", "tokens", "skipped", "nodes", "self ms",
+          "backtracked");
+  long long backtracked = 0;
+  for (int i = 0; i < N_RULES; i++) {
+    RuleStats *s = &totalStats[order[i]];
+    fprintf(stderr,
+            "%-16s %10lld %10lld %8lld %10lld %8lld %10lld %10.2f %11lld\n",
+            ruleNames[order[i]], s->calls, s->found, s->errors, s->tokens,
+            s->skipped, s->nodes, s->ns / 1e6, s->backtracked);
+    backtracked += s->backtracked;
+  }
+  fprintf(stderr, "backtracked tokens: %lld\n", backtracked);
+}
+
+int enterRule(RuleId rule) {
+  static bool reportAtExit = false; // the first rule is parsed by main
+  if (!reportAtExit) {
+    atexit(printRuleStats);
+    reportAtExit = true;
+  }
+  chargeRule();
+  if (nActiveRules == capActiveRules) {
+    capActiveRules = capActiveRules ? capActiveRules * 2 : 64;
+    activeRules = (RuleId *)safeRealloc(activeRules,
+                                        capActiveRules * sizeof(RuleId));
+  }
+  activeRules[nActiveRules++] = rule;
+  ruleStats[rule].calls++;
+  return nConsumed;
+}
+
+// called when the rule returns; a rule returns false only if it consumed
+// nothing
+void leaveRule(int *consumedAtEntry) {
+  chargeRule();
+  RuleId rule = activeRules[--nActiveRules];
+  if (nConsumed != *consumedAtEntry) {
+    ruleStats[rule].found++;
+  }
+}
 
-Guard makeGuard() {
-  Guard guard;
+// an error left the rules after the first nRules; the first of them is the
+// rule of the recovery point, which is kept until its tokens are skipped
+void ruleError(int nRules) {
+  chargeRule();
+  while (nActiveRules > nRules + 1) {
+    ruleStats[activeRules[--nActiveRules]].errors++;
+  }
+  if (nActiveRules > nRules) {
+    ruleStats[activeRules[nRules]].errors++;
+    skippingTokens = true;
+  }
+}
+
+// the tokens after an error were skipped
+void ruleRecovered(int nRules) {
+  chargeRule();
+  nActiveRules = nRules;
+  skippingTokens = false;
+}
+
+// the token from index was consumed
+void countRuleToken(int index) {
+  bool again = index < endConsumedTk;
+  if (!again) {
+    endConsumedTk = index + 1;
+  }
+  if (nActiveRules > 0) {
+    RuleStats *s = &ruleStats[activeRules[nActiveRules - 1]];
+    if (skippingTokens) {
+      s->skipped++;
+    } else {
+      s->tokens++;
+    }
+    if (again) {
+      s->backtracked++;
+    }
+  }
+}
 
-  guard.startInstr=owner?lastInstr(owner->fn.instr):NULL;
-  guard.guardedToken = iTk;
+void countRuleNode() {
+  if (nActiveRules > 0) {
+    ruleStats[activeRules[nActiveRules - 1]].nodes++;
+  }
+}
 
-  return guard; 
+#define RULE_STATS(name)                                                       \
+  int ruleEntry __attribute__((cleanup(leaveRule))) = enterRule(RULE_##name)
+#define ACTIVE_RULES() nActiveRules
+#define RULE_ERROR(nRules) ruleError(nRules)
+#define RULE_RECOVERED(nRules) ruleRecovered(nRules)
+#define RULE_TOKEN(index) countRuleToken(index)
+#define RULE_NODE() countRuleNode()
+#define RULE_STATS_MERGE() mergeRuleStats()
+#define RULE_START(index) (endConsumedTk = (index))
+#else
+#define RULE_STATS(name)
+#define ACTIVE_RULES() 0
+#define RULE_ERROR(nRules)
+#define RULE_RECOVERED(nRules)
+#define RULE_TOKEN(index)
+#define RULE_NODE()
+#define RULE_STATS_MERGE()
+#define RULE_START(index)
+#endif
+
+// returns the code of the token found k tokens after the current one
+// after END, it returns END
+int peek(int k) {
+  for (int i = 0; i < k; i++) {
+    if (tokenAt(iTk + i)->code == END) {
+      return END;
+    }
+  }
+  return tokenAt(iTk + k)->code;
 }
-void restoreGuard(Guard g) { 
-  iTk = g.guardedToken;
-   if(owner) {
-    delInstrAfter(g.startInstr);
-   }
+
+// returns true if code is in FIRST(typeBase)
+bool startsTypeBase(int code) {
+  return code == TYPE_INT || code == TYPE_DOUBLE || code == TYPE_CHAR ||
+         code == STRUCT;
 }
 
-int inStruct = 0;
+_Thread_local int inStruct = 0;
+
+// The errors are recovered in panic mode: tkerr adds a diagnostic and jumps
+// to the innermost recovery point (stm, varDef, structDef, fnDef), which
+// skips the tokens up to the end of its statement or definition, so the
+// parsing continues and finds the next errors.
+
+_Thread_local Diagnostic diagnostics[MAX_DIAGNOSTICS];
+_Thread_local int nDiagnostics = 0;
+
+_Thread_local int nBraces = 0; // the LACC consumed and not closed yet
+
+// a point from which the parsing continues after an error
+typedef struct Recovery {
+  jmp_buf env;
+  int nBraces;    // the open braces when the point was set
+  int iTk;        // the current token when the point was set
+  Domain *domain; // symTable when the point was set
+  Symbol *owner;
+  int inStruct;
+  int nRules;             // the rules being parsed, with PARSER_STATS
+  struct Recovery *outer; // the enclosing recovery point
+} Recovery;
+
+// the innermost recovery point
+_Thread_local Recovery *recovery = NULL;
+// where the parsing stops, after too many errors
+_Thread_local jmp_buf *parseStop = NULL;
 
 void tkerr(const char *fmt, ...) {
+  Diagnostic *d = &diagnostics[nDiagnostics++];
   if (consumedTk == NULL) {
-    fprintf(stderr, "error in line %d: ", iTk->line);
+    d->line = tokenAt(iTk)->line;
   } else {
-    fprintf(stderr, "error in line %d: ", consumedTk->line);
+    d->line = consumedTk->line;
   }
 
   va_list va;
   va_start(va, fmt);
-  vfprintf(stderr, fmt, va);
+  vsnprintf(d->text, sizeof(d->text), fmt, va);
   va_end(va);
 
-  fprintf(stderr, "\n");
-  exit(EXIT_FAILURE);
+  if (recovery && nDiagnostics < MAX_DIAGNOSTICS) {
+    longjmp(recovery->env, 1);
+  }
+  longjmp(*parseStop, 1);
 }
 
 bool consume(int code) {
-  if (iTk->code == code) {
-    consumedTk = iTk;
-    iTk = iTk->next;
+  Token *tk = tokenAt(iTk);
+  if (tk->code == code) {
+    consumedTk = tk;
+    iTk++;
+    nConsumed++;
+    RULE_TOKEN(iTk - 1);
+    if (code == LACC) {
+      nBraces++;
+    } else if (code == RACC && nBraces > 0) {
+      nBraces--;
+    }
     return true;
   }
   return false;
@@ -66,6 +360,7 @@ bool consume(int code) {
 
 // typeBase: TYPE_INT | TYPE_DOUBLE | TYPE_CHAR | STRUCT ID
 bool typeBase(Type *t) {
+  RULE_STATS(typeBase);
   t->n = -1;
   if (consume(TYPE_INT)) {
     t->tb = TB_INT;
@@ -82,7 +377,7 @@ bool typeBase(Type *t) {
   if (consume(STRUCT)) {
     if (consume(ID)) {
       t->tb = TB_STRUCT;
-      t->s = findSymbol(consumedTk->text);
+      t->s = findVisibleSymbol(consumedTk->text);
       if (!t->s) {
         tkerr("Undefined structure: %s", consumedTk->text);
       }
@@ -96,27 +391,30 @@ bool typeBase(Type *t) {
 
 // arrayDecl: LBRACKET INT? RBRACKET
 bool arrayDecl(Type *t) {
-  Guard guard = makeGuard();
-
+  RULE_STATS(arrayDecl);
   if (consume(LBRACKET)) {
     if (consume(INT)) {
       t->n = consumedTk->i;
+      if (typeSizeLong(t) > INT_MAX) {
+        tkerr("array too large");
+      }
     } else {
       t->n = 0;
     }
     if (consume(RBRACKET)) {
       PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found arrayDecl");
       return true;
+    } else {
+      tkerr("Missing ']' in array declaration");
     }
   }
 
-  restoreGuard(guard);
   return false;
 }
 
 // varDef: typeBase ID arrayDecl? SEMICOLON
 bool varDef() {
-  Guard guard = makeGuard();
+  RULE_STATS(varDef);
   Type t;
 
   if (typeBase(&t)) {
@@ -129,29 +427,44 @@ bool varDef() {
           tkerr("A vector variable must have a specified dimension");
         }
       }
+      if (t.tb == TB_STRUCT && t.s == owner) {
+        tkerr("the struct %s cannot contain itself", owner->name);
+      }
+      // the errors are reported before SEMICOLON, so the recovery skips only
+      // this definition
+      if (findSymbolInDomain(symTable, tkName->text)) {
+        tkerr("Symbol redefinition: %s", tkName->text);
+      }
+      if (owner && owner->kind == SK_STRUCT && !structMemberFits(owner, &t)) {
+        tkerr("the struct %s is too large", owner->name);
+      }
+      int varOffset = 0;
+      if (!owner) {
+        // if SEMICOLON is missing, the memory is freed with the unit domain
+        varOffset = allocGlobal(&t);
+        if (varOffset < 0) {
+          tkerr("no more memory for the global variable %s", tkName->text);
+        }
+      }
       if (consume(SEMICOLON)) {
         PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found varDef");
-        Symbol *var = findSymbolInDomain(symTable, tkName->text);
-        if (var) {
-          tkerr("Symbol redefinition: %s", tkName->text);
-        }
-        var = newSymbol(tkName->text, SK_VAR);
+        Symbol *var = newSymbol(tkName->text, SK_VAR);
         var->type = t;
         var->owner = owner;
         addSymbolToDomain(symTable, var);
         if (owner) {
           switch (owner->kind) {
           case SK_FN:
-            var->varIdx = symbolsLen(owner->fn.locals);
-            addSymbolToList(&owner->fn.locals, dupSymbol(var));
+            var->varIdx = owner->fn.locals.n;
+            addSymbolToList(&owner->fn.locals, var);
             break;
           case SK_STRUCT:
-            var->varIdx = typeSize(&owner->type);
-            addSymbolToList(&owner->structMembers, dupSymbol(var));
+            addStructMember(owner, var);
             break;
           }
         } else {
-          var->varMem = safeAlloc(typeSize(&t));
+          var->varOffset = varOffset;
+          var->defIdx = iTk;
         }
         return true;
       } else {
@@ -160,22 +473,20 @@ bool varDef() {
     } else {
       tkerr("Missing varriable name");
     }
-  } else if (inStruct) {
-    if (consume(ID)) {
-      arrayDecl(&t);
-      if (consume(SEMICOLON)) {
-        tkerr("Missing type in variable definition inside struct");
-      }
-    }
+  } else if (inStruct && peek(0) == ID) {
+    tkerr("Missing type in variable definition inside struct");
   }
 
-  restoreGuard(guard);
   return false;
 }
 
+bool withRecovery(bool (*rule)());
+
 // structDef: STRUCT ID LACC varDef* RACC SEMICOLON
+// STRUCT ID starts also a typeBase, so structDef is selected by unit on the
+// third token
 bool structDef() {
-  Guard guard = makeGuard();
+  RULE_STATS(structDef);
   inStruct = 1;
 
   if (consume(STRUCT)) {
@@ -187,16 +498,18 @@ bool structDef() {
           tkerr("symbol redefinition: %s", tkName->text);
         }
         s = addSymbolToDomain(symTable, newSymbol(tkName->text, SK_STRUCT));
+        s->defIdx = iTk;
         s->type.tb = TB_STRUCT;
         s->type.s = s;
         s->type.n = -1;
         pushDomain();
         owner = s;
-        while (varDef())
+        while (withRecovery(varDef))
           ;
         if (consume(RACC)) {
           if (consume(SEMICOLON)) {
             PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found structDef");
+            endStruct(s);
             inStruct = 0;
             owner = NULL;
             // showDomain(symTable, tkName->text);
@@ -208,6 +521,8 @@ bool structDef() {
         } else {
           tkerr("Missing '}' in struct definition");
         }
+      } else {
+        tkerr("Missing '{' in struct definition");
       }
     } else {
       tkerr("Missing struct name in definition");
@@ -215,54 +530,62 @@ bool structDef() {
   }
 
   inStruct = 0;
-
-  restoreGuard(guard);
   return false;
 }
 
 bool expr();
 
+// the nodes of the body of the current function, which are freed after its
+// code is generated
+_Thread_local Arena astArena = ARENA_INIT;
+
+Ast *newNode(AstKind kind) {
+  RULE_NODE();
+  return newAst(&astArena, kind);
+}
+
 // exprPrimary: ID ( LPAR ( expr ( COMMA expr )* )? RPAR )?
 //              | INT | DOUBLE | CHAR | STRING | LPAR expr RPAR
-bool exprPrimary(Ret *r) {
-  Guard guard = makeGuard();
-
+// LPAR expr RPAR is parsed by expr
+bool exprPrimary(Ast **e) {
+  RULE_STATS(exprPrimary);
   // Function call or simple ID
   if (consume(ID)) {
     Token *tkName = consumedTk;
-    Symbol *s = findSymbol(tkName->text);
+    Symbol *s = findVisibleSymbol(tkName->text);
     if (!s) {
       tkerr("undefined id: %s", tkName->text);
     }
     if (consume(LPAR)) {
       if (s->kind != SK_FN)
         tkerr("only a function can be called");
-      Ret rArg;
-      Symbol *param = s->fn.params;
-      if (expr(&rArg)) {
+      Ast *call = newNode(AST_CALL);
+      call->sym = s;
+      Ast **lastArg = &call->list;
+      Symbol *param = s->fn.params.first;
+      Ast *arg;
+      if (expr(&arg)) {
         if (!param) {
           tkerr("too many arguments in function call");
         }
-        if (!convTo(&rArg.type, &param->type)) {
+        if (!convTo(&arg->r.type, &param->type)) {
           tkerr("in call, cannot convert the argument type to the parameter "
                 "type");
         }
-        addRVal(&owner->fn.instr, rArg.lval, &rArg.type);
-        insertConvIfNeeded(lastInstr(owner->fn.instr), &rArg.type,
-                           &param->type);
+        *lastArg = arg;
+        lastArg = &arg->next;
         param = param->next;
         while (consume(COMMA)) {
-          if (expr(&rArg)) {
+          if (expr(&arg)) {
             if (!param) {
               tkerr("too many arguments in function call");
             }
-            if (!convTo(&rArg.type, &param->type)) {
+            if (!convTo(&arg->r.type, &param->type)) {
               tkerr("in call, cannot convert the argument type to the "
                     "parameter type");
             }
-            addRVal(&owner->fn.instr, rArg.lval, &rArg.type);
-            insertConvIfNeeded(lastInstr(owner->fn.instr), &rArg.type,
-                               &param->type);
+            *lastArg = arg;
+            lastArg = &arg->next;
             param = param->next;
           } else {
             tkerr("Expected expression after ','");
@@ -274,13 +597,8 @@ bool exprPrimary(Ret *r) {
         if (param) {
           tkerr("too few arguments in function call");
         }
-        if (s->fn.extFnPtr) {
-          addInstr(&owner->fn.instr, OP_CALL_EXT)->arg.extFnPtr =
-              s->fn.extFnPtr;
-        } else {
-          addInstr(&owner->fn.instr, OP_CALL)->arg.instr = s->fn.instr;
-        }
-        *r = (Ret){s->type, false, true};
+        call->r = (Ret){s->type, false, true};
+        *e = call;
         return true;
       } else {
         tkerr("Missing ')' in function call");
@@ -290,100 +608,77 @@ bool exprPrimary(Ret *r) {
     if (s->kind == SK_FN) {
       tkerr("a function can only be called");
     }
-    if (s->kind == SK_VAR) {
-      if (s->owner == NULL) { // global variables
-        addInstr(&owner->fn.instr, OP_ADDR)->arg.p = s->varMem;
-      } else { // local variables
-        switch (s->type.tb) {
-        case TB_INT:
-          addInstrWithInt(&owner->fn.instr, OP_FPADDR_I, s->varIdx + 1);
-          break;
-        case TB_DOUBLE:
-          addInstrWithInt(&owner->fn.instr, OP_FPADDR_F, s->varIdx + 1);
-          break;
-        }
-      }
-    }
-    if (s->kind == SK_PARAM) {
-      switch (s->type.tb) {
-      case TB_INT:
-        addInstrWithInt(&owner->fn.instr, OP_FPADDR_I,
-                        s->paramIdx - symbolsLen(s->owner->fn.params) - 1);
-        break;
-      case TB_DOUBLE:
-        addInstrWithInt(&owner->fn.instr, OP_FPADDR_F,
-                        s->paramIdx - symbolsLen(s->owner->fn.params) - 1);
-        break;
-      }
+    // the local symbols are freed with their domain, before the code is
+    // generated, so only their offset is kept
+    if (s->kind == SK_VAR && s->owner == NULL) {
+      *e = newNode(AST_VAR);
+      (*e)->sym = s;
+    } else if (s->kind == SK_VAR || s->kind == SK_PARAM) {
+      *e = newNode(AST_LOCAL);
+      (*e)->i = fpOffset(s);
+    } else {
+      *e = newNode(AST_CONST);
     }
-    *r = (Ret){s->type, true, s->type.n >= 0};
+    (*e)->r = (Ret){s->type, true, s->type.n >= 0};
     return true;
   }
 
-  restoreGuard(guard);
-
   // Simple atom
   if (consume(INT)) {
     PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found primaryExpr - atom INT");
-    addInstrWithInt(&owner->fn.instr, OP_PUSH_I, consumedTk->i);
-    *r = (Ret){{TB_INT, NULL, -1}, false, true};
+    *e = newNode(AST_INT);
+    (*e)->i = consumedTk->i;
+    (*e)->r = (Ret){{TB_INT, NULL, -1}, false, true};
     return true;
   } else if (consume(DOUBLE)) {
     PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found primaryExpr - atom DOUBLE");
-    addInstrWithDouble(&owner->fn.instr, OP_PUSH_F, consumedTk->d);
-    *r = (Ret){{TB_DOUBLE, NULL, -1}, false, true};
+    *e = newNode(AST_DOUBLE);
+    (*e)->d = consumedTk->d;
+    (*e)->r = (Ret){{TB_DOUBLE, NULL, -1}, false, true};
     return true;
   } else if (consume(CHAR)) {
     PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found primaryExpr - atom CHAR");
-    *r = (Ret){{TB_CHAR, NULL, -1}, false, true};
+    *e = newNode(AST_CONST);
+    (*e)->r = (Ret){{TB_CHAR, NULL, -1}, false, true};
     return true;
   } else if (consume(STRING)) {
     PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found primaryExpr - atom STRING");
-    *r = (Ret){{TB_CHAR, NULL, 0}, false, true};
+    *e = newNode(AST_CONST);
+    (*e)->r = (Ret){{TB_CHAR, NULL, 0}, false, true};
     return true;
   }
 
-  // Expression with parantheses
-  if (consume(LPAR)) {
-    if (expr(r)) {
-      if (consume(RPAR)) {
-        PRINT_DEBUG(HIGH_VERBOSITY,
-                    "[ADSR] Found primaryExpr - expression with ()");
-        return true;
-      } else {
-        tkerr("Missing ')' at the end of expression");
-      }
-    }
-  }
-
-  restoreGuard(guard);
   return false;
 }
 
 // exprPostfixPrim: LBRACKET expr RBRACKET exprPostfixPrim
 //                  | DOT ID exprPostfixPrim
 //                  | e
-bool exprPostfixPrim(Ret *r) {
-  Guard guard = makeGuard();
-
+bool exprPostfixPrim(Ast **e) {
+  RULE_STATS(exprPostfixPrim);
   // Array indexing
   if (consume(LBRACKET)) {
-    Ret idx;
+    Ast *idx;
     if (expr(&idx)) {
       if (consume(RBRACKET)) {
         PRINT_DEBUG(HIGH_VERBOSITY,
                     "[ADSR] Found exprPostfixPrim - array indexing");
-        if (r->type.n < 0) {
+        if ((*e)->r.type.n < 0) {
           tkerr("only an array can be indexed");
         }
         Type tInt = {TB_INT, NULL, -1};
-        if (!convTo(&idx.type, &tInt)) {
+        if (!convTo(&idx->r.type, &tInt)) {
           tkerr("the index is not convertible to int");
         }
-        r->type.n = -1;
-        r->lval = true;
-        r->ct = false;
-        return exprPostfixPrim(r);
+        Ast *index = newNode(AST_INDEX);
+        index->left = *e;
+        index->right = idx;
+        index->r = (*e)->r;
+        index->r.type.n = -1;
+        index->r.lval = true;
+        index->r.ct = false;
+        *e = index;
+        return exprPostfixPrim(e);
       } else {
         tkerr("Missing ']' in array indexing");
       }
@@ -392,547 +687,482 @@ bool exprPostfixPrim(Ret *r) {
     }
   }
 
-  restoreGuard(guard);
-
   // Struct field access
   if (consume(DOT)) {
     if (consume(ID)) {
       PRINT_DEBUG(HIGH_VERBOSITY,
                   "[ADSR] Found exprPostfixPrim - struct field access");
       Token *tkName = consumedTk;
+      Ret *r = &(*e)->r;
       if (r->type.tb != TB_STRUCT) {
         tkerr("a field can only be selected from a struct");
       }
-      Symbol *s = findSymbolInList(r->type.s->structMembers, tkName->text);
+      Symbol *s = findSymbolInList(&r->type.s->structMembers, tkName->text);
       if (!s) {
         tkerr("the structure %s does not have a field %s", r->type.s->name,
               tkName->text);
       }
-      *r = (Ret){s->type, true, s->type.n >= 0};
-      return exprPostfixPrim(r);
+      Ast *field = newNode(AST_FIELD);
+      field->left = *e;
+      field->sym = s;
+      field->r = (Ret){s->type, true, s->type.n >= 0};
+      *e = field;
+      return exprPostfixPrim(e);
     } else {
       tkerr("Struct field access with no field name specified");
     }
   }
 
-  restoreGuard(guard);
   PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprPostfixPrim - epsilon");
   return true; // e
 }
 
 // exprPostfix: exprPrimary exprPostfixPrim
-bool exprPostfix(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (exprPrimary(r)) {
+bool exprPostfix(Ast **e) {
+  RULE_STATS(exprPostfix);
+  if (exprPrimary(e)) {
     PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Inside exprPrimary");
-    return exprPostfixPrim(r);
+    return exprPostfixPrim(e);
   }
 
-  restoreGuard(guard);
   return false;
 }
 
+// Expressions are parsed by precedence climbing on explicit stacks, so long
+// chains of operators and nested parentheses don't use the C stack.
+// It implements the rules from exprAssign to exprUnary, with the same checks
+// as the recursive rules (see rules.ipynb):
+// exprAssign: exprUnary ASSIGN exprAssign | exprOr
+// exprOr: exprOr OR exprAnd | exprAnd
+// exprAnd: exprAnd AND exprEq | exprEq
+// exprEq: exprEq ( EQUAL | NOTEQ ) exprRel | exprRel
+// exprRel: exprRel ( LESS | LESSEQ | GREATER | GREATEREQ ) exprAdd | exprAdd
+// exprAdd: exprAdd ( ADD | SUB ) exprMul | exprMul
+// exprMul: exprMul ( MUL | DIV ) exprCast | exprCast
+// exprCast: LPAR typeBase arrayDecl? RPAR exprCast | exprUnary
 // exprUnary: ( SUB | NOT ) exprUnary | exprPostfix
-bool exprUnary(Ret *r) {
-  Guard guard = makeGuard();
+// and the LPAR expr RPAR alternative of exprPrimary
 
-  if (consume(SUB) || consume(NOT)) {
-    if (exprUnary(r)) {
-      PRINT_DEBUG(HIGH_VERBOSITY,
-                  "[ADSR] Found exprUnary - (SUB | NOT) exprUnary()");
-      if (!canBeScalar(r)) {
-        tkerr("unary - or ! must have a scalar operand");
-      }
-      r->lval = false;
-      r->ct = true;
-      return true;
-    } else {
-      tkerr("Missing expression after sub or not");
-    }
-  }
+typedef enum {
+  EK_BINARY, // a binary operator, from OR to MUL
+  EK_ASSIGN, // ASSIGN
+  EK_UNARY,  // SUB or NOT before an operand
+  EK_CAST,   // a cast before an operand
+  EK_PAREN   // an open LPAR
+} ExprOpKind;
 
-  restoreGuard(guard);
+// an operator which waits for its right operand
+typedef struct {
+  ExprOpKind kind;
+  Token *tk;     // the operator token
+  Type castType; // for EK_CAST, the type to which it converts
+} ExprOp;
 
-  if (exprPostfix(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprUnary - exprPostfix");
-    return true;
+// an operand
+typedef struct {
+  Ast *e;
+  bool unary; // true if it is an exprUnary, so it can be assigned
+} ExprVal;
+
+// the stacks are shared by the nested calls of expr from function arguments
+// and array indexes; each call uses only the entries above those it found
+_Thread_local ExprOp *exprOps = NULL;
+_Thread_local int nExprOps = 0, capExprOps = 0;
+_Thread_local ExprVal *exprVals = NULL;
+_Thread_local int nExprVals = 0, capExprVals = 0;
+
+void pushExprOp(ExprOpKind kind, Token *tk) {
+  if (nExprOps == capExprOps) {
+    capExprOps = capExprOps ? capExprOps * 2 : 64;
+    exprOps = (ExprOp *)safeRealloc(exprOps, capExprOps * sizeof(ExprOp));
   }
-
-  restoreGuard(guard);
-  return false;
+  ExprOp *op = &exprOps[nExprOps++];
+  op->kind = kind;
+  op->tk = tk;
 }
 
-// exprCast: LPAR typeBase arrayDecl? RPAR exprCast | exprUnary
-bool exprCast(Ret *r) {
-  Guard guard = makeGuard();
-  Type arraySubscriptType;
-
-  if (consume(LPAR)) {
-    Type t;
-    Ret op;
-    if (typeBase(&t)) {
-      if (arrayDecl(&t)) {
-        PRINT_DEBUG(MEDIUM_VERBOSITY,
-                    "[AD] Found array subscript in exprCast with n = %d", t.n);
-      }
-      if (consume(RPAR)) {
-        if (exprCast(&op)) {
-          PRINT_DEBUG(HIGH_VERBOSITY,
-                      "[ADSR] Found exprCast - cast expression");
-          if (t.tb == TB_STRUCT) {
-            tkerr("cannot convert to a struct type");
-          }
-          if (op.type.tb == TB_STRUCT) {
-            tkerr("cannot convert a struct");
-          }
-          if (op.type.n >= 0 && t.n < 0) {
-            tkerr("an array can be converted only to another array");
-          }
-          if (op.type.n < 0 && t.n >= 0) {
-            tkerr("a scalar can be converted only to another scalar");
-          }
-          *r = (Ret){t, false, true};
-          return true;
-        } else {
-          tkerr("Missing casting expression after ')'");
-        }
-      }
-    }
-  }
-
-  restoreGuard(guard);
-
-  if (exprUnary(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprCast - exprUnary");
-    return true;
+void pushExprVal(Ast *e, bool unary) {
+  if (nExprVals == capExprVals) {
+    capExprVals = capExprVals ? capExprVals * 2 : 64;
+    exprVals = (ExprVal *)safeRealloc(exprVals, capExprVals * sizeof(ExprVal));
   }
-
-  restoreGuard(guard);
-  return false;
+  exprVals[nExprVals++] = (ExprVal){e, unary};
 }
 
-// epxrMulPrim: ( MUL | DIV ) exprCast exprMulPrim | e
-bool exprMulPrim(Ret *r) {
-  Guard guard = makeGuard();
-  Token *op = NULL;
-
-  if (consume(MUL) || consume(DIV)) {
-    op = consumedTk;
-
-    Instr *lastLeft = lastInstr(owner->fn.instr);
-    addRVal(&owner->fn.instr, r->lval, &r->type);
-
-    Ret right;
-    if (exprCast(&right)) {
-      PRINT_DEBUG(
-          HIGH_VERBOSITY,
-          "[ADSR] Found exprMulPrim - ( MUL | DIV ) exprCast exprMulPrim ");
-      Type tDst;
-      if (!arithTypeTo(&r->type, &right.type, &tDst)) {
-        tkerr("invalid operand type for * or /");
-      }
-      addRVal(&owner->fn.instr, right.lval, &right.type);
-      insertConvIfNeeded(lastLeft, &r->type, &tDst);
-      insertConvIfNeeded(lastInstr(owner->fn.instr), &right.type, &tDst);
-      switch (op->code) {
-      case MUL:
-        switch (tDst.tb) {
-        case TB_INT:
-          addInstr(&owner->fn.instr, OP_MUL_I);
-          break;
-        case TB_DOUBLE:
-          addInstr(&owner->fn.instr, OP_MUL_F);
-          break;
-        }
-        break;
-      case DIV:
-        switch (tDst.tb) {
-        case TB_INT:
-          addInstr(&owner->fn.instr, OP_DIV_I);
-          break;
-        case TB_DOUBLE:
-          addInstr(&owner->fn.instr, OP_DIV_F);
-          break;
-        }
-        break;
-      }
-
-      *r = (Ret){tDst, false, true};
-      return exprMulPrim(r);
-    } else {
-      char message[50] = "Missing expression after ";
-      switch (consumedTk->code) {
-      case MUL:
-        tkerr(strcat(message, "*"));
-        break;
-      case DIV:
-        tkerr(strcat(message, "/"));
-        break;
-      }
-    }
+// returns the precedence of a binary operator, or 0 if code is not one
+int binaryPrec(int code) {
+  switch (code) {
+  case OR:
+    return 1;
+  case AND:
+    return 2;
+  case EQUAL:
+  case NOTEQ:
+    return 3;
+  case LESS:
+  case LESSEQ:
+  case GREATER:
+  case GREATEREQ:
+    return 4;
+  case ADD:
+  case SUB:
+    return 5;
+  case MUL:
+  case DIV:
+    return 6;
+  default:
+    return 0;
   }
-
-  restoreGuard(guard);
-  PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprMulPrim - epsilon");
-  return true; // e
 }
 
-// exprMul: exprCast exprMulPrim
-bool exprMul(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (exprCast(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Inside exprMul");
-    return exprMulPrim(r);
+// reports the missing operand after op
+void missingOperand(ExprOp *op) {
+  switch (op->kind) {
+  case EK_ASSIGN:
+    tkerr("Missing or invalid expression after assign");
+    break;
+  case EK_UNARY:
+    tkerr("Missing expression after sub or not");
+    break;
+  case EK_CAST:
+    tkerr("Missing casting expression after ')'");
+    break;
+  case EK_PAREN:
+    tkerr("Missing or invalid expression after '('");
+    break;
+  case EK_BINARY:
+    switch (op->tk->code) {
+    case OR:
+      tkerr("Missing expression after or");
+      break;
+    case AND:
+      tkerr("Missing expression after and");
+      break;
+    case EQUAL:
+    case NOTEQ:
+      tkerr("Missing expression after equal or noteq");
+      break;
+    case LESS:
+      tkerr("Missing expression after <");
+      break;
+    case LESSEQ:
+      tkerr("Missing expression after <=");
+      break;
+    case GREATER:
+      tkerr("Missing expression after >");
+      break;
+    case GREATEREQ:
+      tkerr("Missing expression after >=");
+      break;
+    case ADD:
+      tkerr("Missing expression after +");
+      break;
+    case SUB:
+      tkerr("Missing expression after -");
+      break;
+    case MUL:
+      tkerr("Missing expression after *");
+      break;
+    case DIV:
+      tkerr("Missing expression after /");
+      break;
+    }
+    break;
   }
-
-  restoreGuard(guard);
-  return false;
 }
 
-// exprAddPrim: ( ADD | SUB ) exprMul exprAddPrim | e
-bool exprAddPrim(Ret *r) {
-  Guard guard = makeGuard();
-  Token *op = NULL;
-
-  if (consume(ADD) || consume(SUB)) {
-    op = consumedTk;
-
-    Instr *lastLeft = lastInstr(owner->fn.instr);
-    addRVal(&owner->fn.instr, r->lval, &r->type);
-    Ret right;
-    if (exprMul(&right)) {
-      PRINT_DEBUG(
-          HIGH_VERBOSITY,
-          "[ADSR] Found exprAddPrim - ( ADD | SUB ) exprMul exprAddPrim");
-      Type tDst;
-      if (!arithTypeTo(&r->type, &right.type, &tDst)) {
-        tkerr("invalid operand type for + or -");
-      }
-      addRVal(&owner->fn.instr, right.lval, &right.type);
-      insertConvIfNeeded(lastLeft, &r->type, &tDst);
-      insertConvIfNeeded(lastInstr(owner->fn.instr), &right.type, &tDst);
-      switch (op->code) {
-      case ADD:
-        switch (tDst.tb) {
-        case TB_INT:
-          addInstr(&owner->fn.instr, OP_ADD_I);
-          break;
-        case TB_DOUBLE:
-          addInstr(&owner->fn.instr, OP_ADD_F);
-          break;
-        }
-        break;
-      case SUB:
-        switch (tDst.tb) {
-        case TB_INT:
-          addInstr(&owner->fn.instr, OP_SUB_I);
-          break;
-        case TB_DOUBLE:
-          addInstr(&owner->fn.instr, OP_SUB_F);
-          break;
-        }
-        break;
-      }
-      *r = (Ret){tDst, false, true};
-      return exprAddPrim(r);
-    } else {
-      char message[50] = "Missing expression after ";
-      switch (consumedTk->code) {
-      case ADD:
-        tkerr(strcat(message, "+"));
-        break;
-      case SUB:
-        tkerr(strcat(message, "-"));
-        break;
-      }
+// applies the binary operator op to left and right and puts the result in
+// left
+void reduceBinary(ExprOp *op, Ast **left, Ast *right) {
+  int code = op->tk->code;
+  Type tDst;
+  if (!arithTypeTo(&(*left)->r.type, &right->r.type, &tDst)) {
+    switch (code) {
+    case MUL:
+    case DIV:
+      tkerr("invalid operand type for * or /");
+      break;
+    case ADD:
+    case SUB:
+      tkerr("invalid operand type for + or -");
+      break;
+    case LESS:
+    case LESSEQ:
+    case GREATER:
+    case GREATEREQ:
+      tkerr("invalid operand type for <, <=, >, >=");
+      break;
+    case EQUAL:
+    case NOTEQ:
+      tkerr("invalid operand type for == or !=");
+      break;
+    case AND:
+      tkerr("invalid operand type for &&");
+      break;
+    case OR:
+      tkerr("invalid operand type for ||");
+      break;
     }
   }
-
-  restoreGuard(guard);
-  PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprAddPrim - epsilon");
-  return true; // e
-}
-
-// exprAdd: exprMul exprAddPrim
-bool exprAdd(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (exprMul(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprAdd");
-    return exprAddPrim(r);
+  Ast *e = newNode(AST_BINARY);
+  e->op = code;
+  e->left = *left;
+  e->right = right;
+  // the relational and logical operators have an int result
+  if (binaryPrec(code) > binaryPrec(LESS)) {
+    e->r = (Ret){tDst, false, true};
+  } else {
+    e->r = (Ret){{TB_INT, NULL, -1}, false, true};
   }
-
-  restoreGuard(guard);
-  return false;
+  *left = e;
 }
 
-// exprRelPrim: ( LESS | LESSEQ | GREATER | GREATEREQ) exprAdd exprRelPrim
-//              | e
-bool exprRelPrim(Ret *r) {
-  Guard guard = makeGuard();
-  Token *op = NULL;
-
-  if (consume(LESS) || consume(LESSEQ) || consume(GREATER) ||
-      consume(GREATEREQ)) {
-    op = consumedTk;
-
-    Instr *lastLeft = lastInstr(owner->fn.instr);
-    addRVal(&owner->fn.instr, r->lval, &r->type);
-
-    Ret right;
-    if (exprAdd(&right)) {
-      PRINT_DEBUG(HIGH_VERBOSITY,
-                  "[ADSR] Found exprRelPrim - (rel op) exprAdd exprRelPrim");
-      Type tDst;
-      if (!arithTypeTo(&r->type, &right.type, &tDst)) {
-        tkerr("invalid operand type for <, <=, >, >=");
-      }
-
-      addRVal(&owner->fn.instr, right.lval, &right.type);
-      insertConvIfNeeded(lastLeft, &r->type, &tDst);
-      insertConvIfNeeded(lastInstr(owner->fn.instr), &right.type, &tDst);
-      switch (op->code) {
-      case LESS:
-        switch (tDst.tb) {
-        case TB_INT:
-          addInstr(&owner->fn.instr, OP_LESS_I);
-          break;
-        case TB_DOUBLE:
-          addInstr(&owner->fn.instr, OP_LESS_F);
-          break;
-        }
-        break;
-      }
-
-      *r = (Ret){{TB_INT, NULL, -1}, false, true};
-      return exprRelPrim(r);
-    } else {
-      char message[50] = "Missing expression after ";
-      switch (consumedTk->code) {
-      case LESS:
-        tkerr(strcat(message, "<"));
-        break;
-      case LESSEQ:
-        tkerr(strcat(message, "<="));
-        break;
-      case GREATER:
-        tkerr(strcat(message, ">"));
-        break;
-      case GREATEREQ:
-        tkerr(strcat(message, ">="));
-        break;
-      }
-    }
+// assigns the value of src to dst and puts the result in dst
+void reduceAssign(Ast **dst, Ast *src) {
+  Ret *rDst = &(*dst)->r, *rSrc = &src->r;
+  if (!rDst->lval) {
+    tkerr("the assign destination must be a left-value");
   }
-
-  restoreGuard(guard);
-  PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprRelPrim - epsilon");
-  return true; // e
-}
-
-// exprRel: exprAdd exprRelPrim
-bool exprRel(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (exprAdd(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprRel");
-    return exprRelPrim(r);
+  if (rDst->ct) {
+    tkerr("the assign destination cannot be constant");
   }
-
-  restoreGuard(guard);
-  return false;
+  if (!canBeScalar(rDst)) {
+    tkerr("the assign destination must be scalar");
+  }
+  if (!canBeScalar(rSrc)) {
+    tkerr("the assign source must be scalar");
+  }
+  if (!convTo(&rSrc->type, &rDst->type)) {
+    tkerr("the assign source cannot be converted to destination");
+  }
+  Ast *e = newNode(AST_ASSIGN);
+  e->left = *dst;
+  e->right = src;
+  e->r = (Ret){rSrc->type, false, true};
+  *dst = e;
 }
 
-// exprEqPrim: ( EQUAL | NOTEQ ) exprRel exprEqPrim
-//             | e
-bool exprEqPrim(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (consume(EQUAL) || consume(NOTEQ)) {
-    Ret right;
-    if (exprRel(&right)) {
-      PRINT_DEBUG(
-          HIGH_VERBOSITY,
-          "[ADSR] Found exprEqPrim - ( EQUAL | NOTEQ ) exprRel exprEqPrim");
-      Type tDst;
-      if (!arithTypeTo(&r->type, &right.type, &tDst)) {
-        tkerr("invalid operand type for == or !=");
-      }
-      *r = (Ret){{TB_INT, NULL, -1}, false, true};
-      return exprEqPrim(r);
+// applies the operators from the top of the stack down to base, while they
+// are EK_BINARY with a precedence of at least prec, or also EK_ASSIGN if
+// prec is 0
+void reduceOps(int base, int prec) {
+  while (nExprOps > base) {
+    ExprOp *op = &exprOps[nExprOps - 1];
+    if (op->kind == EK_BINARY && binaryPrec(op->tk->code) >= prec) {
+      reduceBinary(op, &exprVals[nExprVals - 2].e, exprVals[nExprVals - 1].e);
+    } else if (op->kind == EK_ASSIGN && prec == 0) {
+      reduceAssign(&exprVals[nExprVals - 2].e, exprVals[nExprVals - 1].e);
     } else {
-      tkerr("Missing expression after equal or noteq");
+      break;
     }
+    exprVals[nExprVals - 2].unary = false;
+    nExprVals--;
+    nExprOps--;
   }
-
-  restoreGuard(guard);
-  PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprEqPrim - epsilon");
-  return true; // e
-}
-
-// exprEq: exprRel exprEqPrim
-bool exprEq(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (exprRel(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprEq");
-    return exprEqPrim(r);
-  }
-
-  restoreGuard(guard);
-  return false;
 }
 
-// exprAndPrim: AND exprEq exprAndPrim
-//              | e
-bool exprAndPrim(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (consume(AND)) {
-    Ret right;
-    if (exprEq(&right)) {
-      PRINT_DEBUG(HIGH_VERBOSITY,
-                  "[ADSR] Found exprAndPrim - AND exprEq exprAndPrim");
-      Type tDst;
-      if (!arithTypeTo(&r->type, &right.type, &tDst)) {
-        tkerr("invalid operand type for &&");
+// applies the unary operators and the casts from the top of the stack
+// to the operand from the top
+void reducePrefixes(int base) {
+  ExprVal *val = &exprVals[nExprVals - 1];
+  while (nExprOps > base) {
+    ExprOp *op = &exprOps[nExprOps - 1];
+    Ret *r = &val->e->r;
+    Ast *e;
+    if (op->kind == EK_UNARY) {
+      if (!canBeScalar(r)) {
+        tkerr("unary - or ! must have a scalar operand");
+      }
+      e = newNode(AST_UNARY);
+      e->op = op->tk->code;
+      e->r = (Ret){r->type, false, true};
+    } else if (op->kind == EK_CAST) {
+      Type *t = &op->castType;
+      if (t->tb == TB_STRUCT) {
+        tkerr("cannot convert to a struct type");
       }
-      *r = (Ret){{TB_INT, NULL, -1}, false, true};
-      return exprAndPrim(r);
+      if (r->type.tb == TB_STRUCT) {
+        tkerr("cannot convert a struct");
+      }
+      if (r->type.n >= 0 && t->n < 0) {
+        tkerr("an array can be converted only to another array");
+      }
+      if (r->type.n < 0 && t->n >= 0) {
+        tkerr("a scalar can be converted only to another scalar");
+      }
+      e = newNode(AST_CAST);
+      e->r = (Ret){*t, false, true};
+      val->unary = false;
     } else {
-      tkerr("Missing expression after and");
+      break;
     }
+    e->left = val->e;
+    val->e = e;
+    nExprOps--;
   }
-
-  restoreGuard(guard);
-  PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprAndPrim - epsilon");
-  return true; // e
-}
-
-// exprAnd: exprEq exprAndPrim
-bool exprAnd(Ret *r) {
-  Guard guard = makeGuard();
-
-  if (exprEq(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprAnd");
-    return exprAndPrim(r);
-  }
-
-  restoreGuard(guard);
-  return false;
 }
 
-// exprOrPrim: OR exprAnd exprOrPrim | e
-bool exprOrPrim(Ret *r) {
-  Guard guard = makeGuard();
+// expr: exprAssign
+bool expr(Ast **e) {
+  RULE_STATS(expr);
+  int opBase = nExprOps, valBase = nExprVals;
+  int nParens = 0; // the open LPAR from the stack
 
-  if (consume(OR)) {
-    Ret right;
-    if (exprAnd(&right)) {
-      PRINT_DEBUG(HIGH_VERBOSITY,
-                  "[ADSR] Found exprOrPrim - OR exprAnd exprOrPrim");
-      Type tDst;
-      if (!arithTypeTo(&r->type, &right.type, &tDst)) {
-        tkerr("invalid operand type for ||");
+  for (;;) {
+    // the prefixes of an operand; a cast cannot follow SUB or NOT
+    bool castAllowed = true;
+    for (;;) {
+      if (castAllowed && peek(0) == LPAR && startsTypeBase(peek(1))) {
+        consume(LPAR);
+        pushExprOp(EK_CAST, consumedTk);
+        Type *t = &exprOps[nExprOps - 1].castType;
+        typeBase(t);
+        if (arrayDecl(t)) {
+          PRINT_DEBUG(MEDIUM_VERBOSITY,
+                      "[AD] Found array subscript in exprCast with n = %d",
+                      t->n);
+        }
+        if (!consume(RPAR)) {
+          tkerr("Missing ')' after the cast type");
+        }
+      } else if (consume(SUB) || consume(NOT)) {
+        pushExprOp(EK_UNARY, consumedTk);
+        castAllowed = false;
+      } else if (consume(LPAR)) {
+        pushExprOp(EK_PAREN, consumedTk);
+        nParens++;
+        castAllowed = true;
+      } else {
+        break;
       }
-      *r = (Ret){{TB_INT, NULL, -1}, false, true};
-      return exprOrPrim(r);
-    } else {
-      tkerr("Missing expression after or");
     }
-  }
 
-  restoreGuard(guard);
-  PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprOrPrim - epsilon");
-  return true; // e
-}
+    Ast *operand;
+    if (!exprPostfix(&operand)) {
+      if (nExprOps == opBase) {
+        return false;
+      }
+      missingOperand(&exprOps[nExprOps - 1]);
+    }
+    pushExprVal(operand, true);
+    reducePrefixes(opBase);
 
-// exprOr: exprAnd exprOrPrim
-bool exprOr(Ret *r) {
-  Guard guard = makeGuard();
+    // the closing parentheses after the operand
+    while (nParens > 0 && peek(0) == RPAR) {
+      reduceOps(opBase, 0);
+      consume(RPAR);
+      PRINT_DEBUG(HIGH_VERBOSITY,
+                  "[ADSR] Found primaryExpr - expression with ()");
+      nExprOps--; // the EK_PAREN
+      nParens--;
+      // exprPostfixPrim can call expr, which can move the stacks
+      Ast *group = exprVals[nExprVals - 1].e;
+      exprPostfixPrim(&group);
+      exprVals[nExprVals - 1] = (ExprVal){group, true};
+      reducePrefixes(opBase);
+    }
 
-  if (exprAnd(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprOr");
-    return exprOrPrim(r);
+    // the operator after the operand
+    int prec = binaryPrec(peek(0));
+    if (prec) {
+      reduceOps(opBase, prec);
+      consume(peek(0));
+      pushExprOp(EK_BINARY, consumedTk);
+      continue;
+    }
+    // only a whole exprUnary can be assigned
+    if (peek(0) == ASSIGN && exprVals[nExprVals - 1].unary &&
+        (nExprOps == opBase || exprOps[nExprOps - 1].kind != EK_BINARY)) {
+      consume(ASSIGN);
+      pushExprOp(EK_ASSIGN, consumedTk);
+      continue;
+    }
+    break;
   }
 
-  restoreGuard(guard);
-  return false;
+  reduceOps(opBase, 0);
+  if (nParens > 0) {
+    tkerr("Missing ')' at the end of expression");
+  }
+  *e = exprVals[valBase].e;
+  nExprVals = valBase;
+  return true;
 }
 
-// exprAssign: exprUnary ASSIGN exprAssign | exprOr
-bool exprAssign(Ret *r) {
-  Guard guard = makeGuard();
-
-  Ret rDst;
-  if (exprUnary(&rDst)) {
-    if (consume(ASSIGN)) {
-      if (exprAssign(r)) {
-        PRINT_DEBUG(HIGH_VERBOSITY,
-                    "[ADSR] Found exprAssign - exprUnary ASSIGN exprAssign");
-
-        addRVal(&owner->fn.instr, r->lval, &r->type);
-        insertConvIfNeeded(lastInstr(owner->fn.instr), &r->type, &rDst.type);
-        switch (rDst.type.tb) {
-        case TB_INT:
-          addInstr(&owner->fn.instr, OP_STORE_I);
-          break;
-        case TB_DOUBLE:
-          addInstr(&owner->fn.instr, OP_STORE_F);
-          break;
-        }
-
-        if (!rDst.lval) {
-          tkerr("the assign destination must be a left-value");
-        }
-        if (rDst.ct) {
-          tkerr("the assign destination cannot be constant");
-        }
-        if (!canBeScalar(&rDst)) {
-          tkerr("the assign destination must be scalar");
-        }
-        if (!canBeScalar(r)) {
-          tkerr("the assign source must be scalar");
-        }
-        if (!convTo(&r->type, &rDst.type)) {
-          tkerr("the assign source cannot be converted to destination");
-        }
-        r->lval = false;
-        r->ct = true;
-        return true;
-      } else {
-        tkerr("Missing or invalid expression after assign");
+// skips the tokens up to the end of the statement or definition which
+// started with the given open braces: after its SEMICOLON, after its RACC
+// and an optional SEMICOLON, or before the RACC of the enclosing block
+void skipStatement(int braces) {
+  for (;;) {
+    int code = peek(0);
+    if (code == END || (code == RACC && nBraces == braces && braces > 0)) {
+      return;
+    }
+    consume(code);
+    if (nBraces == braces && (code == SEMICOLON || code == RACC)) {
+      if (code == RACC) {
+        consume(SEMICOLON);
       }
+      return;
     }
   }
+}
 
-  restoreGuard(guard);
-
-  if (exprOr(r)) {
-    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found exprAssign - exprOr");
-    return true;
+// calls rule as a recovery point: after an error inside it, the state from
+// before rule is restored and the rest of its statement or definition is
+// skipped; returns true if rule found something or tokens were skipped
+bool withRecovery(bool (*rule)()) {
+  Recovery rec = {.nBraces = nBraces,
+                  .iTk = iTk,
+                  .domain = symTable,
+                  .owner = owner,
+                  .inStruct = inStruct,
+                  .nRules = ACTIVE_RULES(),
+                  .outer = recovery};
+  recovery = &rec;
+  bool found;
+  if (setjmp(rec.env) == 0) {
+    found = rule();
+  } else {
+    while (symTable != rec.domain) {
+      dropDomain();
+    }
+    owner = rec.owner;
+    inStruct = rec.inStruct;
+    // the recovery points are not inside expressions
+    nExprOps = 0;
+    nExprVals = 0;
+    RULE_ERROR(rec.nRules);
+    skipStatement(rec.nBraces);
+    RULE_RECOVERED(rec.nRules);
+    found = iTk != rec.iTk;
   }
-
-  restoreGuard(guard);
-  return false;
+  recovery = rec.outer;
+  return found;
 }
 
-// expr: exprAssign
-bool expr(Ret *r) { return exprAssign(r); }
-
-bool stm();
+bool stm(Ast **s);
 // stmCompound: LACC ( varDef | stm )* RACC
-bool stmCompound(bool newDomain) {
-  Guard guard = makeGuard();
-
+bool stmCompound(bool newDomain, Ast **block) {
+  RULE_STATS(stmCompound);
   if (consume(LACC)) {
     if (newDomain) {
       pushDomain();
     }
-    while (varDef() || stm())
-      ;
+    // the local variables have no nodes, only the statements are kept
+    *block = newNode(AST_BLOCK);
+    Ast **last = &(*block)->list;
+    Ast *s;
+    for (;;) {
+      if (withRecovery(varDef)) {
+        continue;
+      }
+      if (!stm(&s)) {
+        break;
+      }
+      *last = s;
+      last = &s->next;
+    }
     if (consume(RACC)) {
       PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found stmCompound");
       if (newDomain) {
@@ -945,52 +1175,45 @@ bool stmCompound(bool newDomain) {
     }
   }
 
-  restoreGuard(guard);
   return false;
 }
 
+// the node of the statement found by stmRule
+_Thread_local Ast *stmNode = NULL;
+
 // stm: stmCompound
 //     | IF LPAR expr RPAR stm ( ELSE stm )?
 //     | WHILE LPAR expr RPAR stm
 //     | RETURN expr? SEMICOLON
 //     | expr? SEMICOLON
-bool stm() {
-  Guard guard = makeGuard();
+bool stmRule() {
+  RULE_STATS(stmRule);
+  Ast *e;
 
-  Ret rCond, rExpr;
-
-  if (stmCompound(true)) {
+  if (stmCompound(true, &e)) {
     PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found stm - compound statement");
+    stmNode = e;
     return true;
   }
 
-  restoreGuard(guard);
-
   // IF structure
   if (consume(IF)) {
     if (consume(LPAR)) {
-      if (expr(&rCond)) {
-        if (!canBeScalar(&rCond)) {
+      if (expr(&e)) {
+        if (!canBeScalar(&e->r)) {
           tkerr("the if condition must be a scalar value");
         }
         if (consume(RPAR)) {
-          addRVal(&owner->fn.instr, rCond.lval, &rCond.type);
-          Type intType = {TB_INT, NULL, -1};
-          insertConvIfNeeded(lastInstr(owner->fn.instr), &rCond.type, &intType);
-          Instr *ifJF = addInstr(&owner->fn.instr, OP_JF);
-          if (stm()) {
+          Ast *s = newNode(AST_IF);
+          s->left = e;
+          if (stm(&s->right)) {
             if (consume(ELSE)) {
-              Instr *ifJMP = addInstr(&owner->fn.instr, OP_JMP);
-              ifJF->arg.instr = addInstr(&owner->fn.instr, OP_NOP);
-              if (stm()) {
-                ifJMP->arg.instr = addInstr(&owner->fn.instr, OP_NOP);
-              } else {
+              if (!stm(&s->elseStm)) {
                 tkerr("Missing statement inside else");
               }
-            } else {
-              ifJF->arg.instr = addInstr(&owner->fn.instr, OP_NOP);
             }
             PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found stm - if statement");
+            stmNode = s;
             return true;
           } else {
             tkerr("Missing statement inside if");
@@ -1008,23 +1231,17 @@ bool stm() {
 
   // WHILE structure
   if (consume(WHILE)) {
-    Instr *beforeWhileCond = lastInstr(owner->fn.instr);
     if (consume(LPAR)) {
-      if (expr(&rCond)) {
-        if (!canBeScalar(&rCond)) {
+      if (expr(&e)) {
+        if (!canBeScalar(&e->r)) {
           tkerr("the while condition must be a scalar value");
         }
         if (consume(RPAR)) {
-          addRVal(&owner->fn.instr, rCond.lval, &rCond.type);
-          Type intType = {TB_INT, NULL, -1};
-          insertConvIfNeeded(lastInstr(owner->fn.instr), &rCond.type, &intType);
-          Instr *whileJF = addInstr(&owner->fn.instr, OP_JF);
-
-          if (stm()) {
-            addInstr(&owner->fn.instr, OP_JMP)->arg.instr =
-                beforeWhileCond->next;
-            whileJF->arg.instr = addInstr(&owner->fn.instr, OP_NOP);
+          Ast *s = newNode(AST_WHILE);
+          s->left = e;
+          if (stm(&s->right)) {
             PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found stm - while statement");
+            stmNode = s;
             return true;
           } else {
             tkerr("Missing statement inside while");
@@ -1043,26 +1260,24 @@ bool stm() {
 
   // RETURN structure RETURN expr? SEMICOLON
   if (consume(RETURN)) {
-    if (expr(&rExpr)) {
-      addRVal(&owner->fn.instr, rExpr.lval, &rExpr.type);
-      insertConvIfNeeded(lastInstr(owner->fn.instr), &rExpr.type, &owner->type);
-      addInstrWithInt(&owner->fn.instr, OP_RET, symbolsLen(owner->fn.params));
-
+    Ast *s = newNode(AST_RETURN);
+    if (expr(&s->left)) {
+      Ret *r = &s->left->r;
       if (owner->type.tb == TB_VOID)
         tkerr("a void function cannot return a value");
-      if (!canBeScalar(&rExpr))
+      if (!canBeScalar(r))
         tkerr("the return value must be a scalar value");
-      if (!convTo(&rExpr.type, &owner->type))
+      if (!convTo(&r->type, &owner->type))
         tkerr("cannot convert the return expression type to the function "
               "return type");
     } else {
-      addInstr(&owner->fn.instr, OP_RET_VOID);
       if (owner->type.tb != TB_VOID) {
         tkerr("a non-void function must return a value");
       }
     }
     if (consume(SEMICOLON)) {
       PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found stm - return statement");
+      stmNode = s;
       return true;
     } else {
       tkerr("Missing ';' after return statement");
@@ -1070,12 +1285,11 @@ bool stm() {
   }
 
   // Simple statement
-  if (expr(&rExpr)) {
-    if (rExpr.type.tb != TB_VOID) {
-      addInstr(&owner->fn.instr, OP_DROP);
-    }
+  if (expr(&e)) {
     if (consume(SEMICOLON)) {
       PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found stm - simple statement");
+      stmNode = newNode(AST_EXPR);
+      stmNode->left = e;
       return true;
     } else {
       tkerr("Missing semicolon after expression");
@@ -1084,16 +1298,26 @@ bool stm() {
 
   if (consume(SEMICOLON)) {
     PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found stm - simple statement");
+    stmNode = newNode(AST_EMPTY);
     return true;
   }
 
-  restoreGuard(guard);
   return false;
 }
 
+// stm with a recovery point, so an error skips only its statement
+// after an error the nodes are not used, so a skipped statement gets an empty
+// node
+bool stm(Ast **s) {
+  stmNode = NULL;
+  bool found = withRecovery(stmRule);
+  *s = stmNode && nDiagnostics == 0 ? stmNode : newNode(AST_EMPTY);
+  return found;
+}
+
 // fnParam: typeBase ID arrayDecl?
 bool fnParam() {
-  Guard guard = makeGuard();
+  RULE_STATS(fnParam);
   Type t;
 
   if (typeBase(&t)) {
@@ -1111,29 +1335,85 @@ bool fnParam() {
       param = newSymbol(tkName->text, SK_PARAM);
       param->type = t;
       param->owner = owner;
-      param->paramIdx = symbolsLen(owner->fn.params);
+      param->paramIdx = owner->fn.params.n;
       addSymbolToDomain(symTable, param);
-      addSymbolToList(&owner->fn.params, dupSymbol(param));
+      addSymbolToList(&owner->fn.params, param);
       PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found fnParam");
       return true;
     } else {
       tkerr("Missing function parameter name");
     }
-  } else {
-    if (consume(ID)) {
-      arrayDecl(&t);
-      tkerr("Missing function parameter type");
-    }
+  } else if (peek(0) == ID) {
+    tkerr("Missing function parameter type");
   }
 
-  restoreGuard(guard);
   return false;
 }
+// the stmCompound of the function fn, from which its code is generated
+bool fnBody(Symbol *fn) {
+  RULE_STATS(fnBody);
+  Ast *body;
+  if (stmCompound(false, &body)) {
+    PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found fnDef");
+    // the code of the body is generated from its nodes, which are freed
+    // together after that; after an error the code is not used, so it is not
+    // generated
+    if (nDiagnostics == 0) {
+      genFn(fn, body);
+    }
+    arenaReset(&astArena);
+    return true;
+  }
+  return false;
+}
+
+// a function body which is compiled after the other definitions were parsed
+typedef struct {
+  Symbol *fn;
+  int start;   // the index of its LACC
+  int end;     // the index of the token after its RACC
+  bool failed; // true if it has errors
+} FnJob;
+
+// if true, fnDef only finds the function bodies and adds them to fnJobs
+bool deferBodies = false;
+FnJob *fnJobs = NULL;
+int nFnJobs = 0, capFnJobs = 0;
+
+// skips the body of fn, up to the RACC which closes its LACC, and adds it to
+// fnJobs; the body is checked when it is compiled
+bool deferBody(Symbol *fn) {
+  if (peek(0) != LACC) {
+    return false;
+  }
+  int start = iTk, depth = 0;
+  do {
+    int code = peek(0);
+    if (code == END) {
+      tkerr("Not a valid instruction or missing '}' after instructions");
+    }
+    consume(code);
+    if (code == LACC) {
+      depth++;
+    } else if (code == RACC) {
+      depth--;
+    }
+  } while (depth > 0);
+  if (nFnJobs == capFnJobs) {
+    capFnJobs = capFnJobs ? capFnJobs * 2 : 64;
+    fnJobs = (FnJob *)safeRealloc(fnJobs, capFnJobs * sizeof(FnJob));
+  }
+  fnJobs[nFnJobs++] = (FnJob){fn, start, iTk, false};
+  return true;
+}
+
 // fnDef: ( typeBase | VOID ) ID
 //         LPAR ( fnParam ( COMMA fnParam )* )? RPAR
 //             stmCompound
+// typeBase starts also a varDef, so fnDef is selected by unit on the token
+// after the function name
 bool fnDef() {
-  Guard guard = makeGuard();
+  RULE_STATS(fnDef);
   Type t;
 
   if (typeBase(&t) || consume(VOID)) {
@@ -1149,6 +1429,7 @@ bool fnDef() {
         }
         fn = newSymbol(tkName->text, SK_FN);
         fn->type = t;
+        fn->defIdx = iTk;
         addSymbolToDomain(symTable, fn);
         owner = fn;
         pushDomain();
@@ -1160,14 +1441,7 @@ bool fnDef() {
           }
         }
         if (consume(RPAR)) {
-          addInstr(&fn->fn.instr, OP_ENTER);
-          if (stmCompound(false)) {
-            PRINT_DEBUG(HIGH_VERBOSITY, "[ADSR] Found fnDef");
-            fn->fn.instr->arg.i = symbolsLen(fn->fn.locals);
-            if (fn->type.tb == TB_VOID) {
-              addInstrWithInt(&fn->fn.instr, OP_RET_VOID,
-                              symbolsLen(fn->fn.params));
-            }
+          if (deferBodies ? deferBody(fn) : fnBody(fn)) {
             dropDomain();
             owner = NULL;
             return true;
@@ -1178,38 +1452,454 @@ bool fnDef() {
           tkerr("Function parameters not correctly defined or missing ')' in "
                 "function definition");
         }
+      } else {
+        tkerr("Missing '(' after function name");
       }
-    } else if (!arrayDecl(&t) && !consume(SEMICOLON)) {
+    } else {
       tkerr("Missing function name or '{' after struct definition");
     }
   }
 
-  restoreGuard(guard);
   return false;
 }
 
+// returns true if the tokens from the current one start a structDef
+// STRUCT ID LACC, or STRUCT without a name, which is reported by structDef
+bool startsStructDef() {
+  return peek(0) == STRUCT && (peek(1) != ID || peek(2) == LACC);
+}
+
+// returns true if the tokens from the current one start a fnDef
+// ( typeBase | VOID ) ID LPAR, or a type which is not followed by the
+// varDef tokens, for which fnDef reports the missing function name
+bool startsFnDef() {
+  int k; // the index of the token after the type
+  switch (peek(0)) {
+  case VOID:
+    return true;
+  case TYPE_INT:
+  case TYPE_DOUBLE:
+  case TYPE_CHAR:
+    k = 1;
+    break;
+  case STRUCT:
+    k = 2;
+    break;
+  default:
+    return false;
+  }
+  if (peek(k) == ID) {
+    return peek(k + 1) == LPAR;
+  }
+  return peek(k) != LBRACKET && peek(k) != SEMICOLON;
+}
+
+// a varDef at the global level, where any other token is an error
+bool globalVarDef() {
+  RULE_STATS(globalVarDef);
+  if (!varDef()) {
+    tkerr("syntax error");
+  }
+  return true;
+}
+
 // unit: ( structDef | fnDef | varDef )* END
+// each definition is a recovery point
 bool unit() {
-  for (;;) {
-    if (structDef()) {
+  RULE_STATS(unit);
+  while (peek(0) != END) {
+    if (startsStructDef()) {
+      withRecovery(structDef);
       PRINT_DEBUG(LOW_VERBOSITY, "FOUND STRUCT DEF");
-    } else if (fnDef()) {
+    } else if (startsFnDef()) {
+      withRecovery(fnDef);
       PRINT_DEBUG(LOW_VERBOSITY, "FOUND FUNC DEF");
-    } else if (varDef()) {
+    } else {
+      withRecovery(globalVarDef);
       PRINT_DEBUG(LOW_VERBOSITY, "FOUND VAR DEF");
-    } else
+    }
+    // the parser never comes back before the last consumed token
+    if (lexer) {
+      lexerRelease(lexer, iTk - 1);
+    }
+  }
+  consume(END);
+  PRINT_DEBUG(LOW_VERBOSITY, "[ADSR] %d tokens consumed", nConsumed);
+  return true;
+}
+
+// sets the targets of the calls from all the functions of the unit
+void linkUnit(Domain *unitDomain) {
+  for (int i = 0; i < unitDomain->nSymbols; i++) {
+    if (unitDomain->symbols[i]->kind == SK_FN) {
+      linkCalls(unitDomain->symbols[i]);
+    }
+  }
+}
+
+// parses the tokens from tokens or lexer
+bool parseUnit() {
+  iTk = 0;
+  RULE_START(iTk);
+  consumedTk = NULL;
+  nConsumed = 0;
+  nBraces = 0;
+  nDiagnostics = 0;
+  pushDomain();
+  Domain *unitDomain = symTable;
+  jmp_buf stop;
+  parseStop = &stop;
+  if (setjmp(stop) == 0) {
+    unit();
+  } else {
+    // too many errors
+    RULE_ERROR(0);
+    RULE_RECOVERED(0);
+    while (symTable != unitDomain) {
+      dropDomain();
+    }
+    owner = NULL;
+    inStruct = 0;
+    nExprOps = 0;
+    nExprVals = 0;
+  }
+  recovery = NULL;
+  parseStop = NULL;
+  // the nodes left by a function with errors
+  arenaFree(&astArena);
+  if (nDiagnostics == 0 && !deferBodies) {
+    linkUnit(unitDomain);
+  }
+  return nDiagnostics == 0;
+}
+
+bool parse(Token *allTokens) {
+  tokens = allTokens;
+  lexer = NULL;
+  return parseUnit();
+}
+
+// compiles the body of job->fn on the current thread, where the parsing
+// continues from the state after the RPAR of the function
+void compileFnJob(FnJob *job, Domain *unitDomain) {
+  symTable = unitDomain;
+  pushDomain();
+  for (Symbol *param = job->fn->fn.params.first; param; param = param->next) {
+    addSymbolToDomain(symTable, param);
+  }
+  owner = job->fn;
+  iTk = job->start;
+  RULE_START(iTk);
+  consumedTk = tokenAt(iTk - 1);
+  nBraces = 0;
+  nDiagnostics = 0;
+  visibleUntil = job->start;
+  jmp_buf stop;
+  parseStop = &stop;
+  if (setjmp(stop) == 0) {
+    job->failed = !fnBody(job->fn) || iTk != job->end;
+  } else {
+    job->failed = true;
+    RULE_ERROR(0);
+    RULE_RECOVERED(0);
+  }
+  job->failed = job->failed || nDiagnostics > 0;
+  while (symTable != unitDomain) {
+    dropDomain();
+  }
+  owner = NULL;
+  recovery = NULL;
+  parseStop = NULL;
+  visibleUntil = INT_MAX;
+  nExprOps = 0;
+  nExprVals = 0;
+  arenaReset(&astArena);
+}
+
+#ifndef _WIN32
+// the function bodies shared by the threads of runFnJobs, which take them
+// in order
+typedef struct {
+  Token *tokens;
+  Domain *unitDomain;
+  FnJob *jobs;
+  int nJobs;
+  atomic_int next; // the index of the next job which is not taken
+} JobQueue;
+
+void *fnJobsThread(void *arg) {
+  JobQueue *q = (JobQueue *)arg;
+  tokens = q->tokens;
+  for (;;) {
+    int i = atomic_fetch_add(&q->next, 1);
+    if (i >= q->nJobs) {
       break;
+    }
+    compileFnJob(&q->jobs[i], q->unitDomain);
   }
-  if (consume(END)) {
+  // the memory kept by the thread for the next function
+  arenaFree(&astArena);
+  free(exprOps);
+  free(exprVals);
+  exprOps = NULL;
+  exprVals = NULL;
+  capExprOps = 0;
+  capExprVals = 0;
+  genRelease();
+  RULE_STATS_MERGE();
+  return NULL;
+}
+
+// a thread started by runFnJobs, which has only its own domains, so it
+// frees all their memory at exit
+void *fnJobsWorker(void *arg) {
+  fnJobsThread(arg);
+  domainsRelease();
+  return NULL;
+}
+
+// runs the jobs on up to nThreads threads, including the current one
+// returns true if all the jobs were compiled without errors
+bool runFnJobs(FnJob *jobs, int nJobs, Domain *unitDomain, int nThreads) {
+  if (nThreads > nJobs) {
+    nThreads = nJobs;
+  }
+  if (nThreads < 1) {
     return true;
   }
-  return false;
+  JobQueue q = {tokens, unitDomain, jobs, nJobs, 0};
+  pthread_t threads[nThreads];
+  int nStarted = 0;
+  while (nStarted < nThreads - 1 &&
+         pthread_create(&threads[nStarted], NULL, fnJobsWorker, &q) == 0) {
+    nStarted++;
+  }
+  fnJobsThread(&q);
+  for (int i = 0; i < nStarted; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  for (int i = 0; i < nJobs; i++) {
+    if (jobs[i].failed) {
+      return false;
+    }
+  }
+  return true;
+}
+#else
+bool runFnJobs(FnJob *jobs, int nJobs, Domain *unitDomain, int nThreads) {
+  bool compiled = true;
+  for (int i = 0; i < nJobs; i++) {
+    compileFnJob(&jobs[i], unitDomain);
+    compiled = compiled && !jobs[i].failed;
+  }
+  return compiled;
+}
+#endif
+
+// parses allTokens like parse, but the function bodies are compiled by
+// runFnJobs; they are left in fnJobs, unless the unit has errors
+bool compileUnit(Token *allTokens, int nThreads) {
+  nFnJobs = 0;
+  deferBodies = true;
+  bool parsed = parse(allTokens);
+  deferBodies = false;
+  if (parsed && runFnJobs(fnJobs, nFnJobs, symTable, nThreads)) {
+    linkUnit(symTable);
+    return true;
+  }
+  // the unit is parsed again without threads, so the errors are reported
+  // in the same order and with the same recovery as by parse
+  nFnJobs = 0;
+  dropDomain();
+  return parse(allTokens);
 }
 
-void parse(Token *tokens) {
-  iTk = tokens;
-  pushDomain();
-  if (!unit()) {
-    tkerr("syntax error");
+bool parseParallel(Token *allTokens, int nThreads) {
+  if (nThreads < 2) {
+    return parse(allTokens);
+  }
+  bool parsed = compileUnit(allTokens, nThreads);
+  free(fnJobs);
+  fnJobs = NULL;
+  nFnJobs = 0;
+  capFnJobs = 0;
+  return parsed;
+}
+
+// The unit kept by reparse. Its domain stays on the symbols stack and the
+// positions of its function bodies in keptTokens stay in fnJobs.
+bool unitKept = false;    // true if the domain of the unit is on the stack
+Token *keptTokens = NULL; // NULL if the unit had errors
+int nKeptTokens = 0;      // the number of tokens, including END
+
+// returns true if the tokens a and b are the same, except their lines
+bool sameTokenValue(Token *a, Token *b) {
+  if (a->code != b->code) {
+    return false;
+  }
+  switch (a->code) {
+  case ID:
+  case STRING:
+    return a->text == b->text && a->len == b->len;
+  case INT:
+    return a->i == b->i;
+  case CHAR:
+    return a->c == b->c;
+  case DOUBLE:
+    return memcmp(&a->d, &b->d, sizeof(double)) == 0;
+  default:
+    return true;
   }
 }
+
+// compares allTokens with keptTokens in one pass, with the function bodies
+// found as by deferBody: each body starts with a LACC after a RPAR, outside
+// of other braces, and ends after its RACC
+// returns false if the tokens outside of the bodies are not the same, else
+// sets the new positions of the kept bodies in bodies, the changed ones in
+// changed and the number of tokens, including END, in *nTokens
+bool diffBodies(Token *allTokens, FnJob *bodies, bool *changed,
+                int *nTokens) {
+  int i = 0, j = 0, k = 0, depth = 0;
+  for (;;) {
+    Token *tk = &allTokens[i];
+    if (!sameTokenValue(tk, &keptTokens[j])) {
+      return false;
+    }
+    if (tk->code == END) {
+      break;
+    }
+    if (tk->code == LACC && depth == 0 && i > 0 &&
+        allTokens[i - 1].code == RPAR) {
+      if (k == nFnJobs || fnJobs[k].start != j) {
+        return false;
+      }
+      int start = i, oldEnd = fnJobs[k].end, bodyDepth = 0;
+      bool same = true;
+      do {
+        int code = allTokens[i].code;
+        if (code == END) {
+          return false;
+        }
+        if (code == LACC) {
+          bodyDepth++;
+        } else if (code == RACC) {
+          bodyDepth--;
+        }
+        same = same && j < oldEnd &&
+               sameTokenValue(&allTokens[i], &keptTokens[j]);
+        i++;
+        j++;
+      } while (bodyDepth > 0);
+      bodies[k] = (FnJob){fnJobs[k].fn, start, i, false};
+      changed[k++] = !same || j != oldEnd;
+      j = oldEnd;
+      continue;
+    }
+    if (tk->code == LACC) {
+      depth++;
+    } else if (tk->code == RACC) {
+      depth--;
+    }
+    i++;
+    j++;
+  }
+  *nTokens = i + 1;
+  return k == nFnJobs;
+}
+
+// compiles again only the changed bodies of the kept unit, if its tokens
+// outside of the function bodies are the same as in allTokens
+// returns the number of compiled bodies, or -1 if the unit must be compiled
+// again from the start
+int recompileBodies(Token *allTokens, int nThreads) {
+  int nBodies = nFnJobs, nTokens;
+  FnJob *bodies = (FnJob *)safeAlloc((nBodies + 1) * sizeof(FnJob));
+  bool *changed = (bool *)safeAlloc((nBodies + 1) * sizeof(bool));
+  if (!diffBodies(allTokens, bodies, changed, &nTokens)) {
+    free(bodies);
+    free(changed);
+    return -1;
+  }
+
+  // the global symbols are moved with the tokens before them
+  Domain *unitDomain = symTable;
+  int k = 0;
+  for (int i = 0; i < unitDomain->nSymbols; i++) {
+    Symbol *s = unitDomain->symbols[i];
+    while (k < nBodies && s->defIdx >= fnJobs[k].start) {
+      k++;
+    }
+    s->defIdx +=
+        k < nBodies ? bodies[k].start - fnJobs[k].start : nTokens - nKeptTokens;
+  }
+
+  // the changed bodies are compiled again, after their old code is freed
+  // only the first instruction of the old code is kept, because the calls
+  // to the function jump to it
+  FnJob *jobs = (FnJob *)safeAlloc((nBodies + 1) * sizeof(FnJob));
+  Instr **entries = (Instr **)safeAlloc((nBodies + 1) * sizeof(Instr *));
+  int nJobs = 0;
+  for (int i = 0; i < nBodies; i++) {
+    if (!changed[i]) {
+      continue;
+    }
+    Symbol *fn = bodies[i].fn;
+    freeSymbols(&fn->fn.locals);
+    Instr *entry = fn->fn.instr.first;
+    instrRollback(&fn->fn.instr, entry);
+    fn->fn.instr.first = fn->fn.instr.last = NULL;
+    entries[nJobs] = entry;
+    jobs[nJobs++] = bodies[i];
+  }
+  tokens = allTokens;
+  bool compiled = runFnJobs(jobs, nJobs, unitDomain, nThreads);
+  for (int i = 0; i < nJobs; i++) {
+    if (compiled) {
+      keepFnEntry(jobs[i].fn, entries[i]);
+    } else {
+      free(entries[i]);
+    }
+  }
+  if (compiled) {
+    for (int i = 0; i < nJobs; i++) {
+      linkCalls(jobs[i].fn);
+    }
+    memcpy(fnJobs, bodies, nBodies * sizeof(FnJob));
+    nKeptTokens = nTokens;
+  }
+  free(bodies);
+  free(changed);
+  free(jobs);
+  free(entries);
+  return compiled ? nJobs : -1;
+}
+
+bool reparse(Token *allTokens, int nThreads, int *nCompiled) {
+  if (keptTokens) {
+    int n = recompileBodies(allTokens, nThreads);
+    if (n >= 0) {
+      keptTokens = allTokens;
+      *nCompiled = n;
+      return true;
+    }
+  }
+  if (unitKept) {
+    dropDomain();
+  }
+  bool parsed = compileUnit(allTokens, nThreads);
+  unitKept = true;
+  keptTokens = parsed ? allTokens : NULL;
+  nKeptTokens = 1;
+  while (allTokens[nKeptTokens - 1].code != END) {
+    nKeptTokens++;
+  }
+  *nCompiled = nFnJobs;
+  return parsed;
+}
+
+bool parseStream(Lexer *lx) {
+  tokens = NULL;
+  lexer = lx;
+  return parseUnit();
+}
@@ -0,0 +1,8 @@
+// an expression nested 200000 levels deep in parentheses and unary operators,
+// which is parsed and generated without recursion
+int f(){
+  return -(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!((-(!(1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+}
+void main(){
+  put_i(1);
+}
@@ -0,0 +1,13 @@
+// each error is reported, and only its definition or statement is skipped
+int a;
+int a;
+struct S{
+  int x;
+  int x;
+};
+void main(){
+  int b;
+  int b;
+  x = 1;
+  y = 2;
+}
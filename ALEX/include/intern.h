@@ -0,0 +1,36 @@
+#pragma once
+
+// identifiers interning
+// each distinct identifier is stored only once, so two interned names are
+// equal if and only if they are the same pointer
+
+// returns the interned copy of the first len chars from text
+// the returned string is null terminated and it is never freed
+const char *intern(const char *text, int len);
+
+// returns the interned copy of a null terminated string
+const char *internStr(const char *text);
+
+// returns the hash of an interned string, computed when it was interned
+unsigned atomHash(const char *atom);
+
+// private tables, for the threads which intern strings in parallel with the
+// shared table used by intern; their atoms are not equal to the shared atoms
+typedef struct InternTable InternTable;
+
+// returns a new empty private table
+InternTable *newInternTable();
+
+// returns the copy of the first len chars from text from the private table t
+const char *internIn(InternTable *t, const char *text, int len);
+
+// interns in the shared table all the strings from the private table t
+// it must not run in parallel with the other users of the shared table
+void shareAtoms(InternTable *t);
+
+// returns the shared atom equal to an atom from a private table, after
+// shareAtoms was called for that table; for a shared atom returns itself
+const char *sharedAtom(const char *atom);
+
+// frees the private table t and all its atoms
+void freeInternTable(InternTable *t);
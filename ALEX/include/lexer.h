@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdio.h>
+
 typedef enum {
   ID = 0,
   TYPE_CHAR,
@@ -45,13 +47,51 @@ typedef struct Token {
   int code; // ID, TYPE_CHAR, ...
   int line; // the line from the input file
   union {
-    char *text; // the chars for ID, STRING (dynamically allocated)
+    struct {
+      const char *text; // the chars for ID, STRING (interned, see intern.h)
+      int len;          // the number of chars from text
+    };
     int i;      // the value for INT
     char c;     // the value for CHAR
     double d;   // the value for DOUBLE
   };
-  struct Token *next; // next token in a simple linked list
 } Token;
 
+// returns a contiguous array with all the tokens, ended by END
 Token *tokenize(const char *pch);
+
+// like tokenize, but lexes on up to nThreads threads, in chunks split after
+// new lines; len is the number of chars from pch, without the final '\0'
+// the small inputs are lexed sequentially
+Token *tokenizeParallel(const char *pch, size_t len, int nThreads);
 void showTokens(const Token *tokens);
+
+// prints a token to fout, as a line of showTokens
+void showToken(FILE *fout, const Token *tk);
+
+// frees in one call the tokens array returned by tokenize
+void freeTokens(Token *tokens);
+
+// incremental lexer, which reads its input in chunks from a stream
+// (a file, stdin or a pipe) and keeps in memory only a window of tokens
+typedef struct Lexer Lexer;
+
+// creates a lexer which reads from fis; fis is not closed by the lexer
+Lexer *lexerOpen(FILE *fis);
+
+// frees the lexer and all its tokens
+void lexerClose(Lexer *lx);
+
+// lexes the next token from input and returns it
+// after the END token, it returns END again
+Token *nextToken(Lexer *lx);
+
+// returns the token with the given index from the start of input, lexing
+// more input if needed; the index cannot be before the released tokens
+// the returned pointer is valid until the token is released
+Token *lexerToken(Lexer *lx, int idx);
+
+// frees the tokens before the token with the given index
+// the released tokens cannot be accessed anymore, so idx must be before any
+// position to which the parser may come back
+void lexerRelease(Lexer *lx, int idx);
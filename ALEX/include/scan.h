@@ -0,0 +1,18 @@
+#pragma once
+
+// fast scanning of runs of chars in a null terminated buffer
+// with SSE2 the chars are tested 16 at a time, else a scalar loop is used
+// all the functions stop at the terminating '\0' and never read past the
+// 16 bytes aligned block which contains it
+
+// returns the first char after pch which is not ' ' or '\t'
+const char *skipSpaces(const char *pch);
+
+// returns the first char after pch which cannot be in an ID: [A-Za-z0-9_]
+const char *skipIdChars(const char *pch);
+
+// returns the first occurrence of ch after pch, or the terminating '\0'
+const char *findChar(const char *pch, char ch);
+
+// returns the end of a // comment: the first '\n', '\t' or '\0'
+const char *findCommentEnd(const char *pch);
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "lexer.h"
+
+// on-disk cache of the tokens of a source, keyed by a hash of its content
+// each source is cached in the file <cacheDir>/<hash>.tok, which keeps
+// the tokens codes, lines and values and the texts of IDs and STRINGs
+// the cache files are only for the same build, they are not portable
+
+// returns the tokens of pch, like tokenizeParallel: from the cache file in
+// cacheDir if it exists and it is valid, else it lexes pch on up to nThreads
+// threads and saves the tokens in the cache
+// if the cache cannot be written, the tokens are returned without caching
+// if verify, pch is always lexed and the cached tokens are compared with
+// the lexed ones; on a difference it prints both tokens and exits
+Token *tokenizeCached(const char *pch, const char *cacheDir, int nThreads,
+                      bool verify);
@@ -28,6 +28,80 @@ noreturn void throwError(const char *format, ...);
 // and exit the program
 void *safeAlloc(size_t nBytes);
 
+// reallocs memory using realloc, with the same error handling as safeAlloc
+void *safeRealloc(void *p, size_t nBytes);
+
 // loads a text file in a dynamically allocated memory and returns it
 // on error, prints a message and exit the program
 char *loadFile(const char *fileName);
+
+// maps a text file read-only in memory and returns it (null terminated)
+// sets in *size the file size, which must be given back to unmapFile
+// if the file cannot be mapped with a terminating '\0', it falls back to loadFile
+// on error, prints a message and exit the program
+const char *mapFile(const char *fileName, size_t *size);
+
+// releases a buffer returned by mapFile
+void unmapFile(const char *buf, size_t size);
+
+// the modification time (in ns) and the size of a file, which change
+// when the file is written
+typedef struct {
+  long long mtime;
+  long long size;
+} FileStamp;
+
+// returns the stamp of a file, or {-1, -1} if the file cannot be found
+FileStamp fileStamp(const char *fileName);
+
+// suspends the current thread for ms milliseconds
+void sleepMs(int ms);
+
+// reserves size bytes of address space, for a memory which is used from its
+// start and grows up to size; its pages are zeroed and take physical memory
+// only when they are first used
+// on error, prints a message and exit the program
+void *reserveMemory(size_t size);
+
+// makes usable size bytes from p, from a memory returned by reserveMemory
+// on Windows the pages must be committed before they are used
+// on error, prints a message and exit the program
+void commitMemory(void *p, size_t size);
+
+// zeroes size bytes from p, from the committed memory of reserveMemory
+// the whole pages are given back to the OS instead of being written
+void zeroMemory(void *p, size_t size);
+
+// a region from which many small objects are allocated and then freed
+// together; the objects are aligned for any type
+typedef struct ArenaBlock ArenaBlock;
+typedef struct {
+  ArenaBlock *blocks; // the current block is the first
+  char *free;         // the free space from the current block
+  char *end;
+  ArenaBlock *spare;  // a block released by arenaRelease, kept for reuse
+} Arena;
+
+#define ARENA_INIT {NULL, NULL, NULL, NULL}
+
+// allocs nBytes from arena, with the same error handling as safeAlloc
+void *arenaAlloc(Arena *arena, size_t nBytes);
+
+// frees all the objects from arena, but keeps its first block for reuse
+void arenaReset(Arena *arena);
+
+// frees all the memory of arena
+void arenaFree(Arena *arena);
+
+// a position in an arena, to which the arena can be released, so the arena
+// can be used as a stack of regions
+typedef struct {
+  ArenaBlock *block;
+  char *free;
+} ArenaMark;
+
+// returns the current position of arena
+ArenaMark arenaMark(Arena *arena);
+
+// frees all the objects allocated from arena after mark
+void arenaRelease(Arena *arena, ArenaMark mark);
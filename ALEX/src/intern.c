@@ -0,0 +1,123 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "intern.h"
+#include "utils.h"
+
+#define INITIAL_BUCKETS 1024
+
+typedef struct Atom {
+  struct Atom *next;  // the next atom from the same bucket
+  const char *shared; // the copy of text from the shared table
+  unsigned hash;      // the hash of text
+  int len;            // the number of chars from text
+  char text[];        // the interned chars, null terminated
+} Atom;
+
+struct InternTable {
+  Atom **buckets; // the hash table, with chaining in buckets
+  int nBuckets;   // always a power of 2
+  int nAtoms;     // the number of distinct interned strings
+};
+
+InternTable sharedTable = {NULL, 0, 0}; // the table used by intern
+
+// FNV-1a
+unsigned hashText(const char *text, int len) {
+  unsigned h = 2166136261u;
+  for (int i = 0; i < len; i++) {
+    h ^= (unsigned char)text[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+Atom *atomOf(const char *atom) {
+  return (Atom *)(atom - offsetof(Atom, text));
+}
+
+// doubles the number of buckets and redistributes the atoms
+void growBuckets(InternTable *t) {
+  int n = t->nBuckets ? t->nBuckets * 2 : INITIAL_BUCKETS;
+  Atom **b = (Atom **)safeAlloc(n * sizeof(Atom *));
+  memset(b, 0, n * sizeof(Atom *));
+  for (int i = 0; i < t->nBuckets; i++) {
+    for (Atom *a = t->buckets[i], *next; a; a = next) {
+      next = a->next;
+      a->next = b[a->hash & (n - 1)];
+      b[a->hash & (n - 1)] = a;
+    }
+  }
+  free(t->buckets);
+  t->buckets = b;
+  t->nBuckets = n;
+}
+
+// returns the atom from t for text, which has the hash h
+Atom *internHashed(InternTable *t, const char *text, int len, unsigned h) {
+  if (t->nAtoms >= t->nBuckets) {
+    growBuckets(t);
+  }
+
+  Atom **bucket = &t->buckets[h & (t->nBuckets - 1)];
+  for (Atom *a = *bucket; a; a = a->next) {
+    if (a->hash == h && a->len == len && memcmp(a->text, text, len) == 0) {
+      return a;
+    }
+  }
+
+  Atom *a = (Atom *)safeAlloc(sizeof(Atom) + len + 1);
+  a->hash = h;
+  a->len = len;
+  memcpy(a->text, text, len);
+  a->text[len] = '\0';
+  a->shared = t == &sharedTable ? a->text : NULL;
+  a->next = *bucket;
+  *bucket = a;
+  t->nAtoms++;
+  return a;
+}
+
+const char *intern(const char *text, int len) {
+  return internHashed(&sharedTable, text, len, hashText(text, len))->text;
+}
+
+const char *internStr(const char *text) {
+  return intern(text, (int)strlen(text));
+}
+
+unsigned atomHash(const char *atom) { return atomOf(atom)->hash; }
+
+InternTable *newInternTable() {
+  InternTable *t = (InternTable *)safeAlloc(sizeof(InternTable));
+  t->buckets = NULL;
+  t->nBuckets = 0;
+  t->nAtoms = 0;
+  return t;
+}
+
+const char *internIn(InternTable *t, const char *text, int len) {
+  return internHashed(t, text, len, hashText(text, len))->text;
+}
+
+void shareAtoms(InternTable *t) {
+  for (int i = 0; i < t->nBuckets; i++) {
+    for (Atom *a = t->buckets[i]; a; a = a->next) {
+      a->shared = internHashed(&sharedTable, a->text, a->len, a->hash)->text;
+    }
+  }
+}
+
+const char *sharedAtom(const char *atom) { return atomOf(atom)->shared; }
+
+void freeInternTable(InternTable *t) {
+  for (int i = 0; i < t->nBuckets; i++) {
+    for (Atom *a = t->buckets[i], *next; a; a = next) {
+      next = a->next;
+      free(a);
+    }
+  }
+  free(t->buckets);
+  free(t);
+}
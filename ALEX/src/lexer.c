@@ -1,95 +1,199 @@
 #include <ctype.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "intern.h"
 #include "lexer.h"
+#include "scan.h"
 #include "utils.h"
 
-Token *tokens = NULL; // single linked list of tokens
-Token *lastTk = NULL; // the last token in list
+#define INITIAL_TOKENS 256
+#define BLOCK_BITS 10
+#define BLOCK_TOKENS (1 << BLOCK_BITS) // the number of tokens in a window block
+#define CHUNK_SIZE 65536 // the number of chars read at once from a stream
+#define MIN_PARALLEL_CHUNK (256 * 1024) // smaller chunks are not worth a thread
+
+struct Lexer {
+  int line;    // the current line in the input
+  int nTokens; // the number of tokens lexed from the start of the input
+
+  // when all the input is in memory, the tokens are kept in a contiguous array
+  Token *tokens;
+  int capTokens; // the number of tokens for which there is room in array
+
+  // when lexing a stream, only a window with the last tokens is kept, in fixed
+  // size blocks, so the tokens don't move when the window grows
+  FILE *fis;          // the input stream, NULL if all the input is in memory
+  Token **blocks;     // blocks[0] starts with the token with index firstIdx
+  int nBlocks;        // the number of blocks in use
+  int capBlocks;      // the number of blocks for which there is room in blocks
+  int firstIdx;       // the index of the first token kept, multiple of BLOCK_TOKENS
+  char *buf;          // the chars read from fis and not lexed yet, null terminated
+  size_t bufLen;      // the number of chars from buf
+  size_t bufCap;      // the number of chars for which there is room in buf
+  const char *pch;    // the current position in buf
+  const char *lastNl; // the last '\n' from buf, NULL if there is none
+  bool eof;           // true if all the input from fis was read in buf
+
+  // when lexing a chunk in parallel with other chunks
+  InternTable *atoms; // the private table for the chunk's IDs and STRINGs
+  jmp_buf *onError;   // where to jump on errors, instead of reporting them
+};
+
+// The classes of chars. The class of the first char of a token selects how
+// the token is lexed.
+typedef enum {
+  CC_INVALID = 0, // a char which cannot start a token
+  CC_BLANK,       // ' ', '\t'
+  CC_CR,          // '\r', a new line alone or before '\n'
+  CC_NEWLINE,     // '\n'
+  CC_END,         // '\0'
+  CC_SINGLE,      // a token of one char: , ; ( ) [ ] { } + - * .
+  CC_OPERATOR,    // a token of one or two chars: & | ! < > =
+  CC_SLASH,       // DIV or the start of a comment
+  CC_QUOTE,       // the start of a STRING
+  CC_APOSTROPHE,  // the start of a CHAR
+  CC_DIGIT,       // the start of an INT or DOUBLE
+  CC_LETTER,      // the start of an ID or keyword: [A-Za-z_]
+} CharClass;
+
+// the class of each char; the chars which are not listed are CC_INVALID
+const unsigned char charClasses[256] = {
+    [' '] = CC_BLANK, ['\t'] = CC_BLANK, ['\r'] = CC_CR, ['\n'] = CC_NEWLINE,
+    ['\0'] = CC_END, [','] = CC_SINGLE, [';'] = CC_SINGLE, ['('] = CC_SINGLE,
+    [')'] = CC_SINGLE, ['['] = CC_SINGLE, [']'] = CC_SINGLE, ['{'] = CC_SINGLE,
+    ['}'] = CC_SINGLE, ['+'] = CC_SINGLE, ['-'] = CC_SINGLE, ['*'] = CC_SINGLE,
+    ['.'] = CC_SINGLE, ['&'] = CC_OPERATOR, ['|'] = CC_OPERATOR,
+    ['!'] = CC_OPERATOR, ['<'] = CC_OPERATOR, ['>'] = CC_OPERATOR,
+    ['='] = CC_OPERATOR, ['/'] = CC_SLASH, ['"'] = CC_QUOTE,
+    ['\''] = CC_APOSTROPHE,
+    ['0'] = CC_DIGIT, ['1'] = CC_DIGIT, ['2'] = CC_DIGIT, ['3'] = CC_DIGIT,
+    ['4'] = CC_DIGIT, ['5'] = CC_DIGIT, ['6'] = CC_DIGIT, ['7'] = CC_DIGIT,
+    ['8'] = CC_DIGIT, ['9'] = CC_DIGIT,
+    ['A'] = CC_LETTER, ['B'] = CC_LETTER, ['C'] = CC_LETTER, ['D'] = CC_LETTER,
+    ['E'] = CC_LETTER, ['F'] = CC_LETTER, ['G'] = CC_LETTER, ['H'] = CC_LETTER,
+    ['I'] = CC_LETTER, ['J'] = CC_LETTER, ['K'] = CC_LETTER, ['L'] = CC_LETTER,
+    ['M'] = CC_LETTER, ['N'] = CC_LETTER, ['O'] = CC_LETTER, ['P'] = CC_LETTER,
+    ['Q'] = CC_LETTER, ['R'] = CC_LETTER, ['S'] = CC_LETTER, ['T'] = CC_LETTER,
+    ['U'] = CC_LETTER, ['V'] = CC_LETTER, ['W'] = CC_LETTER, ['X'] = CC_LETTER,
+    ['Y'] = CC_LETTER, ['Z'] = CC_LETTER, ['a'] = CC_LETTER, ['b'] = CC_LETTER,
+    ['c'] = CC_LETTER, ['d'] = CC_LETTER, ['e'] = CC_LETTER, ['f'] = CC_LETTER,
+    ['g'] = CC_LETTER, ['h'] = CC_LETTER, ['i'] = CC_LETTER, ['j'] = CC_LETTER,
+    ['k'] = CC_LETTER, ['l'] = CC_LETTER, ['m'] = CC_LETTER, ['n'] = CC_LETTER,
+    ['o'] = CC_LETTER, ['p'] = CC_LETTER, ['q'] = CC_LETTER, ['r'] = CC_LETTER,
+    ['s'] = CC_LETTER, ['t'] = CC_LETTER, ['u'] = CC_LETTER, ['v'] = CC_LETTER,
+    ['w'] = CC_LETTER, ['x'] = CC_LETTER, ['y'] = CC_LETTER, ['z'] = CC_LETTER,
+    ['_'] = CC_LETTER,
+};
+
+// the tokens of the CC_SINGLE chars
+const TokenType singleTokens[256] = {
+    [','] = COMMA,    [';'] = SEMICOLON, ['('] = LPAR, [')'] = RPAR,
+    ['['] = LBRACKET, [']'] = RBRACKET,  ['{'] = LACC, ['}'] = RACC,
+    ['+'] = ADD,      ['-'] = SUB,       ['*'] = MUL,  ['.'] = DOT,
+};
+
+// The transitions from the first char of a CC_OPERATOR token: to pair if
+// the next char is second, else to alone. END as alone marks the operators
+// which must be doubled.
+typedef struct {
+  char second;
+  TokenType alone;
+  TokenType pair;
+} Operator;
+
+const Operator operators[256] = {
+    ['&'] = {'&', END, AND},       ['|'] = {'|', END, OR},
+    ['!'] = {'=', NOT, NOTEQ},     ['<'] = {'=', LESS, LESSEQ},
+    ['>'] = {'=', GREATER, GREATEREQ},
+    ['='] = {'=', ASSIGN, EQUAL},
+};
+
+// the running lexer, to which the tokens are added; each thread has its own
+_Thread_local Lexer *crtLexer = NULL;
+
+// Reports a lexing error and exits.
+// A chunk lexed in parallel may start inside a string, so its errors can be
+// wrong. They are not reported, but the chunk is lexed again sequentially.
+#define lexError(...)                                                          \
+  do {                                                                         \
+    if (crtLexer->onError) {                                                   \
+      longjmp(*crtLexer->onError, 1);                                          \
+    }                                                                          \
+    throwError(__VA_ARGS__);                                                   \
+  } while (0)
+
+// Returns the atom for text, from the chunk's table when lexing in parallel.
+const char *lexIntern(const char *text, int len) {
+  return crtLexer->atoms ? internIn(crtLexer->atoms, text, len)
+                         : intern(text, len);
+}
 
-int line = 1; // the current line in the input file
+// Returns the token with the given index from the window of a stream lexer.
+Token *windowToken(Lexer *lx, int idx) {
+  int rel = idx - lx->firstIdx;
+  return &lx->blocks[rel >> BLOCK_BITS][rel & (BLOCK_TOKENS - 1)];
+}
 
-// Adds a token to the end of the tokens list and returns it.
+// Adds a token to the end of the tokens of the running lexer and returns it.
 // Sets it's code and line.
+// For an in-memory lexer, the returned pointer is valid only until the next
+// addToken.
 Token *addToken(int code) {
-  Token *tk = (Token *)safeAlloc(sizeof(Token));
+  Lexer *lx = crtLexer;
+  Token *tk;
+  if (lx->fis) {
+    // Add a new block to the window if the last one is full
+    if (((lx->nTokens - lx->firstIdx) >> BLOCK_BITS) == lx->nBlocks) {
+      if (lx->nBlocks == lx->capBlocks) {
+        lx->capBlocks = lx->capBlocks ? lx->capBlocks * 2 : 4;
+        lx->blocks =
+            (Token **)safeRealloc(lx->blocks, lx->capBlocks * sizeof(Token *));
+      }
+      lx->blocks[lx->nBlocks++] =
+          (Token *)safeAlloc(BLOCK_TOKENS * sizeof(Token));
+    }
+    tk = windowToken(lx, lx->nTokens);
+  } else {
+    // Grow the array geometrically, so the tokens stay in a single block
+    if (lx->nTokens == lx->capTokens) {
+      lx->capTokens = lx->capTokens ? lx->capTokens * 2 : INITIAL_TOKENS;
+      lx->tokens =
+          (Token *)safeRealloc(lx->tokens, lx->capTokens * sizeof(Token));
+    }
+    tk = &lx->tokens[lx->nTokens];
+  }
+  lx->nTokens++;
 
   // Initialize token
   tk->code = code;
-  tk->line = line;
-  tk->next = NULL;
-
-  // Place token in list
-  if (lastTk) {
-    lastTk->next = tk;
-  } else {
-    tokens = tk;
-  }
-  lastTk = tk;
+  tk->line = lx->line;
 
   return tk;
 }
 
-char *extract(const char *begin, const char *end) {
-  if (end < begin) {
-    throwError("Not a valid string segment");
-  }
-
-  // Alloc space for segment
-  size_t size_of_segment = end - begin;
-  char *segment = (char *)safeAlloc(size_of_segment * sizeof(char) + 1);
-
-  // Copy segment
-  strncpy(segment, begin, size_of_segment);
-  segment[size_of_segment] = '\0';
-
-  return segment;
-}
-
-const char *handleComment(const char *pch) {
-  while (!strchr("\n\t\0", *pch)) {
-    ++pch;
-  }
-  return pch;
-}
+const char *handleComment(const char *pch) { return findCommentEnd(pch); }
 
-const char *handle_possibly_double_char(const char *pch, char ch,
-                                        TokenType if_yes, TokenType if_no) {
-  if (pch[1] == ch) {
-    addToken(if_yes);
+const char *handle_operator(const char *pch) {
+  const Operator *op = &operators[(unsigned char)*pch];
+  if (pch[1] == op->second) {
+    addToken(op->pair);
     return pch + 2;
-  } else {
-    addToken(if_no);
-    return pch + 1;
   }
-}
-
-const char *handle_mandatory_double_char(const char *pch, char ch,
-                                         TokenType if_yes) {
-  if (pch[1] == ch) {
-    addToken(if_yes);
-  } else {
-    throwError("Invalid random alone '%c'", ch);
-  }
-  return pch + 2;
-}
-
-const char *handle_double_char(const char *pch) {
-  if (*pch == '&') {
-    return handle_mandatory_double_char(pch, *pch, AND);
-  } else if (*pch == '|') {
-    return handle_mandatory_double_char(pch, *pch, OR);
-  } else {
-    const char *operators = "!<>=";
-    TokenType if_yes_values[] = {NOTEQ, LESSEQ, GREATEREQ, EQUAL};
-    TokenType if_no_values[] = {NOT, LESS, GREATER, ASSIGN};
-
-    size_t idx = strchr(operators, *pch) - operators;
-    return handle_possibly_double_char(pch, '=', if_yes_values[idx],
-                                       if_no_values[idx]);
+  if (op->alone == END) {
+    lexError("Invalid random alone '%c'", *pch);
   }
+  addToken(op->alone);
+  return pch + 1;
 }
 
 const char *handle_char(const char *pch) {
@@ -109,152 +213,485 @@ const char *handle_slash(const char *pch) {
   }
 }
 
-const char *handle_single_char(const char *pch) {
-  const char *single_chars = ",;()[]{}+-*.";
-  TokenType match_for_chars[] = {COMMA,    SEMICOLON, LPAR, RPAR,
-                                 LBRACKET, RBRACKET,  LACC, RACC,
-                                 ADD,      SUB,       MUL,  DOT};
-
-  // Get token index
-  const char *char_ptr = strchr(single_chars, *pch);
-  size_t idx = char_ptr - single_chars;
-
-  addToken(match_for_chars[idx]);
-  return pch + 1;
+#define MAX_MANTISSA_DIGITS 19       // all the 19 digits numbers fit in uint64_t
+#define MAX_EXACT_MANTISSA (1ULL << 53) // the integers exactly stored in double
+#define MAX_EXACT_POWER 22              // 1e22 is the last exact power of 10
+
+// the powers of 10 which are exactly represented as double
+const double exactPowersOf10[MAX_EXACT_POWER + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// The decimal digits of a number literal, accumulated in a single pass.
+typedef struct {
+  uint64_t mantissa; // the first significant digits
+  int nDigits;       // the number of digits from mantissa
+  int exponent;      // value = mantissa * 10^exponent
+  bool truncated;    // true if some non-zero digits didn't fit in mantissa
+} Digits;
+
+// Accumulates the digits from pch and returns the first char after them.
+// The digits after the decimal point decrease the exponent.
+const char *scanDigits(const char *pch, Digits *d, bool fraction) {
+  for (; isdigit(*pch); ++pch) {
+    int digit = *pch - '0';
+    if (d->nDigits < MAX_MANTISSA_DIGITS) {
+      d->mantissa = d->mantissa * 10 + digit;
+      // the leading zeros are not significant
+      d->nDigits += d->mantissa != 0;
+      d->exponent -= fraction;
+    } else {
+      d->truncated |= digit != 0;
+      d->exponent += !fraction;
+    }
+  }
+  return pch;
 }
 
+// Scans an INT or a DOUBLE in a single pass:
+//   INT: [0-9]+
+//   DOUBLE: [0-9]+ ( '.' [0-9]+ )? ( [eE] [+-]? [0-9]+ )? with '.' or exponent
+// The DOUBLE value is computed directly when the mantissa and the power of 10
+// are both exact doubles, which makes the result correctly rounded. The other
+// literals (more than 15-16 significant digits or very large exponents) are
+// converted with strtod.
 const char *handle_number(const char *pch) {
-  char *endLong, *endDouble;
-  long number = strtol(pch, &endLong, 10);
-  double numberDouble = strtod(pch, &endDouble);
+  const char *start = pch;
+  Digits d = {0, 0, 0, false};
+  pch = scanDigits(pch, &d, false);
+
+  if (*pch != '.' && *pch != 'e' && *pch != 'E') {
+    // like strtol, saturate on overflow, then keep the int part
+    long number = d.exponent || d.mantissa > LONG_MAX ? LONG_MAX
+                                                       : (long)d.mantissa;
+    Token *tk = addToken(INT);
+    tk->i = (int)number;
+    return pch;
+  }
 
-  // Verifications
-  if(*(endDouble - 1) == '.') {
-    throwError("Double ends in . without further digits");
+  if (*pch == '.') {
+    if (!isdigit(pch[1])) {
+      lexError("Double ends in . without further digits");
+    }
+    pch = scanDigits(pch + 1, &d, true);
   }
 
-  if(*endDouble == 'E') {
-    throwError("Double Exponent ends without further digits");
+  if (*pch == 'e' || *pch == 'E') {
+    ++pch;
+    int sign = 1;
+    if (*pch == '+' || *pch == '-') {
+      sign = *pch++ == '-' ? -1 : 1;
+    }
+    if (!isdigit(*pch)) {
+      lexError("Double Exponent ends without further digits");
+    }
+    int exponent = 0;
+    for (; isdigit(*pch); ++pch) {
+      // larger exponents overflow or underflow anyway, so they are not needed
+      if (exponent < 100000) {
+        exponent = exponent * 10 + (*pch - '0');
+      }
+    }
+    d.exponent += sign * exponent;
   }
 
-  if (endLong == endDouble) {
-    Token *tk = addToken(INT);
-    tk->i = number;
-    return endLong;
-  } else if (endDouble != pch) {
-    Token *tk = addToken(DOUBLE);
-    tk->d = numberDouble;
-    return endDouble;
+  double number;
+  if (d.mantissa == 0 && !d.truncated) {
+    number = 0;
+  } else if (!d.truncated && d.mantissa <= MAX_EXACT_MANTISSA &&
+             d.exponent >= -MAX_EXACT_POWER && d.exponent <= MAX_EXACT_POWER) {
+    number = d.exponent < 0 ? d.mantissa / exactPowersOf10[-d.exponent]
+                            : d.mantissa * exactPowersOf10[d.exponent];
+  } else {
+    number = strtod(start, NULL);
   }
+
+  Token *tk = addToken(DOUBLE);
+  tk->d = number;
+  return pch;
 }
 
-void handle_text(char *text) {
-  const char *keywords[] = {"char",   "double", "int",  "else", "if",
-                            "return", "struct", "void", "while"};
-  TokenType tokens[] = {TYPE_CHAR, TYPE_DOUBLE, TYPE_INT, ELSE, IF,
-                        RETURN,    STRUCT,      VOID,     WHILE};
-
-  size_t number_of_keywords = 9;
-  for(size_t idx = 0; idx < number_of_keywords; ++idx) {
-    if(strcmp(text, keywords[idx]) == 0) {
-      addToken(tokens[idx]);
-      return;
+// Returns the code of the keyword from text or ID if it is not a keyword.
+// The keywords have distinct (length, first char) pairs, so the candidate is
+// selected by a switch and at most one memcmp is done for each identifier.
+TokenType keywordCode(const char *text, int len) {
+  switch (len) {
+  case 2:
+    if (text[0] == 'i' && text[1] == 'f')
+      return IF;
+    break;
+  case 3:
+    if (memcmp(text, "int", 3) == 0)
+      return TYPE_INT;
+    break;
+  case 4:
+    switch (text[0]) {
+    case 'c':
+      return memcmp(text, "char", 4) == 0 ? TYPE_CHAR : ID;
+    case 'e':
+      return memcmp(text, "else", 4) == 0 ? ELSE : ID;
+    case 'v':
+      return memcmp(text, "void", 4) == 0 ? VOID : ID;
+    }
+    break;
+  case 5:
+    if (memcmp(text, "while", 5) == 0)
+      return WHILE;
+    break;
+  case 6:
+    switch (text[0]) {
+    case 'd':
+      return memcmp(text, "double", 6) == 0 ? TYPE_DOUBLE : ID;
+    case 'r':
+      return memcmp(text, "return", 6) == 0 ? RETURN : ID;
+    case 's':
+      return memcmp(text, "struct", 6) == 0 ? STRUCT : ID;
     }
+    break;
+  }
+  return ID;
+}
+
+void handle_text(const char *text, int len) {
+  TokenType code = keywordCode(text, len);
+  if (code != ID) {
+    addToken(code);
+    return;
   }
 
   // If not keyword
   Token *tk = addToken(ID);
-  tk->text = text;
+  tk->text = lexIntern(text, len);
+  tk->len = len;
 }
 
 const char *handle_id_or_keyword(const char *pch) {
-  Token *tk = NULL;
+  // The text from start to pch is viewed in place, without copying it
+  const char *start = pch;
+  pch = skipIdChars(pch + 1);
 
-  // Extract the portion of text from start to pch
-  const char *start = pch++;
-  while (isalnum(*pch) || *pch == '_') {
-    ++pch;
+  handle_text(start, (int)(pch - start));
+
+  return pch;
+}
+
+const char *handle_string(const char *pch) {
+  ++pch; // Jump over '"'
+  const char *end = findChar(pch, '"');
+  if (*end != '"') {
+    lexError("Missing '\"' at the end of string");
   }
-  char *text = extract(start, pch);
+  size_t number_of_chars_in_string = end - pch;
 
-  handle_text(text);
+  Token *tk = addToken(STRING);
+  tk->text = lexIntern(pch, (int)number_of_chars_in_string);
+  tk->len = (int)number_of_chars_in_string;
 
+  return pch + number_of_chars_in_string + 1;
+}
+
+// Lexes the input from pch until it adds a token or it consumes a blank,
+// a new line or a comment. Returns the position after them.
+// After it adds END, returns NULL.
+const char *lexStep(const char *pch) {
+  switch (charClasses[(unsigned char)*pch]) {
+  case CC_BLANK:
+    pch = skipSpaces(pch + 1);
+    break;
+  case CC_CR:
+    pch += (pch[1] == '\n' ? 1 : 0);
+    // fallthrough to \n
+  case CC_NEWLINE:
+    crtLexer->line++;
+    pch++;
+    break;
+  case CC_END:
+    addToken(END);
+    return NULL;
+  case CC_SINGLE:
+    addToken(singleTokens[(unsigned char)*pch]);
+    pch++;
+    break;
+  case CC_OPERATOR:
+    pch = handle_operator(pch);
+    break;
+  case CC_SLASH:
+    pch = handle_slash(pch);
+    break;
+  case CC_QUOTE:
+    pch = handle_string(pch);
+    break;
+  case CC_APOSTROPHE:
+    pch = handle_char(pch);
+    break;
+  case CC_DIGIT:
+    pch = handle_number(pch);
+    break;
+  case CC_LETTER:
+    pch = handle_id_or_keyword(pch);
+    break;
+  default:
+    lexError("Invalid char: %c (%d)", *pch, *pch);
+  }
   return pch;
 }
 
-const char *handle_default(const char *pch) {
-  if (isdigit(*pch)) {
-    return handle_number(pch);
-  } else if (isalpha(*pch) || *pch == '_') {
-    return handle_id_or_keyword(pch);
+Token *tokenize(const char *pch) {
+  Lexer lx = {.line = 1};
+  crtLexer = &lx;
+  while (pch) {
+    pch = lexStep(pch);
+  }
+  crtLexer = NULL;
+  return lx.tokens;
+}
+
+#ifndef _WIN32
+// A part of the input lexed by its own thread. It starts after a '\n', so it
+// can start inside a multiline STRING, but never inside a comment or other
+// tokens. Its tokens are valid only if the previous chunk stopped at start.
+typedef struct {
+  const char *start; // the first char of the chunk
+  const char *end;   // the char after the chunk
+  const char *stop;  // where the lexing stopped, at or after end; NULL at END
+  bool failed;       // true if the lexing stopped with an error
+  Lexer lx;          // the chunk's tokens, with lines counted from 0
+  int firstLine;     // the line of the first char lexed
+  int firstIdx;      // the index of the chunk's first token in the result
+  Token *result;     // the array with the tokens of all the chunks
+} Chunk;
+
+// Lexes c from pch, where the previous token ended or c->start.
+// If speculative, the errors only set c->failed.
+void lexChunk(Chunk *c, const char *pch, bool speculative) {
+  jmp_buf onError;
+  memset(&c->lx, 0, sizeof(Lexer));
+  c->lx.atoms = newInternTable();
+  c->lx.onError = speculative ? &onError : NULL;
+  c->failed = false;
+  crtLexer = &c->lx;
+  if (setjmp(onError)) {
+    c->failed = true;
   } else {
-    throwError("Invalid char: %c (%d)", *pch, *pch);
+    while (pch && pch < c->end) {
+      pch = lexStep(pch);
+    }
+    c->stop = pch;
   }
+  crtLexer = NULL;
 }
 
-const char *handle_string(const char *pch) {
-  ++pch; // Jump over '"'
-  size_t number_of_chars_in_string = strchr(pch, '"') - pch;
+void freeChunk(Chunk *c) {
+  free(c->lx.tokens);
+  freeInternTable(c->lx.atoms);
+}
 
-  Token *tk = addToken(STRING);
-  tk->text = extract(pch, pch + number_of_chars_in_string);
+void *lexChunkThread(void *arg) {
+  Chunk *c = (Chunk *)arg;
+  lexChunk(c, c->start, true);
+  return NULL;
+}
 
-  return pch + number_of_chars_in_string + 1;
+// Moves the chunk's tokens in the result, with their final lines and atoms.
+void *copyChunkThread(void *arg) {
+  Chunk *c = (Chunk *)arg;
+  Token *dst = c->result + c->firstIdx;
+  for (int i = 0; i < c->lx.nTokens; i++) {
+    dst[i] = c->lx.tokens[i];
+    dst[i].line += c->firstLine;
+    if (dst[i].code == ID || dst[i].code == STRING) {
+      dst[i].text = sharedAtom(dst[i].text);
+    }
+  }
+  freeChunk(c);
+  return NULL;
 }
 
-Token *tokenize(const char *pch) {
-  for (;;) {
-    switch (*pch) {
-    case ' ':
-    case '\t':
-      pch++;
-      break;
-    case '\r':
-      pch += (pch[1] == '\n' ? 1 : 0);
-      // fallthrough to \n
-    case '\n':
-      line++;
-      pch++;
-      break;
-    case '\0':
-      addToken(END);
-      return tokens;
-    case ',':
-    case ';':
-    case '(':
-    case ')':
-    case '[':
-    case ']':
-    case '{':
-    case '}':
-    case '+':
-    case '-':
-    case '*':
-    case '.':
-      pch = handle_single_char(pch);
-      break;
-    case '"':
-      pch = handle_string(pch);
-      break;
-    case '\'':
-      pch = handle_char(pch);
-      break;
-    case '/':
-      pch = handle_slash(pch);
+// Runs fn for each chunk, on its own thread.
+void runChunkThreads(Chunk *chunks, int nChunks, void *(*fn)(void *)) {
+  pthread_t threads[nChunks];
+  for (int i = 0; i < nChunks; i++) {
+    if (pthread_create(&threads[i], NULL, fn, &chunks[i]) != 0) {
+      throwError("Cannot create a lexer thread");
+    }
+  }
+  for (int i = 0; i < nChunks; i++) {
+    pthread_join(threads[i], NULL);
+  }
+}
+
+Token *tokenizeParallel(const char *pch, size_t len, int nThreads) {
+  if (nThreads > (int)(len / MIN_PARALLEL_CHUNK)) {
+    nThreads = (int)(len / MIN_PARALLEL_CHUNK);
+  }
+  if (nThreads < 2) {
+    return tokenize(pch);
+  }
+
+  // Split the input in chunks of almost equal size, after new lines
+  Chunk chunks[nThreads];
+  int nChunks = 0;
+  const char *start = pch, *inputEnd = pch + len;
+  while (start < inputEnd) {
+    const char *end = inputEnd + 1; // the last chunk includes the final '\0'
+    const char *middle = start + len / nThreads;
+    if (nChunks < nThreads - 1 && middle < inputEnd) {
+      const char *nl = (const char *)memchr(middle, '\n', inputEnd - middle);
+      if (nl) {
+        end = nl + 1;
+      }
+    }
+    chunks[nChunks++] = (Chunk){.start = start, .end = end};
+    start = end;
+  }
+
+  runChunkThreads(chunks, nChunks, lexChunkThread);
+
+  // Link the chunks in order. A chunk which doesn't start where the previous
+  // one stopped or which failed is lexed again, so the errors are reported
+  // as in sequential lexing.
+  const char *crt = pch;
+  int line = 1, nTokens = 0, nUsed = 0;
+  while (nUsed < nChunks) {
+    Chunk *c = &chunks[nUsed++];
+    if (c->start != crt || c->failed) {
+      freeChunk(c);
+      lexChunk(c, crt, false);
+    }
+    c->firstLine = line;
+    c->firstIdx = nTokens;
+    line += c->lx.line;
+    nTokens += c->lx.nTokens;
+    shareAtoms(c->lx.atoms);
+    crt = c->stop;
+    if (!crt) {
       break;
-    case '&':
-    case '|':
-    case '!':
-    case '<':
-    case '>':
-    case '=':
-      pch = handle_double_char(pch);
+    }
+  }
+  for (int i = nUsed; i < nChunks; i++) {
+    freeChunk(&chunks[i]);
+  }
+
+  Token *tokens = (Token *)safeAlloc(nTokens * sizeof(Token));
+  for (int i = 0; i < nUsed; i++) {
+    chunks[i].result = tokens;
+  }
+  runChunkThreads(chunks, nUsed, copyChunkThread);
+  return tokens;
+}
+#else
+Token *tokenizeParallel(const char *pch, size_t len, int nThreads) {
+  return tokenize(pch);
+}
+#endif
+
+Lexer *lexerOpen(FILE *fis) {
+  Lexer *lx = (Lexer *)safeAlloc(sizeof(Lexer));
+  memset(lx, 0, sizeof(Lexer));
+  lx->line = 1;
+  lx->fis = fis;
+  lx->bufCap = CHUNK_SIZE + 1;
+  lx->buf = (char *)safeAlloc(lx->bufCap);
+  lx->buf[0] = '\0';
+  lx->pch = lx->buf;
+  return lx;
+}
+
+void lexerClose(Lexer *lx) {
+  for (int i = 0; i < lx->nBlocks; i++) {
+    free(lx->blocks[i]);
+  }
+  free(lx->blocks);
+  free(lx->buf);
+  free(lx);
+}
+
+// Moves the chars not lexed yet at the start of buf and reads after them
+// at least CHUNK_SIZE chars, growing buf if needed.
+void refill(Lexer *lx) {
+  size_t kept = lx->bufLen - (lx->pch - lx->buf);
+  memmove(lx->buf, lx->pch, kept);
+  if (lx->bufCap - kept - 1 < CHUNK_SIZE) {
+    lx->bufCap = lx->bufCap * 2 > kept + CHUNK_SIZE + 1 ? lx->bufCap * 2
+                                                         : kept + CHUNK_SIZE + 1;
+    lx->buf = (char *)safeRealloc(lx->buf, lx->bufCap);
+  }
+
+  size_t wanted = lx->bufCap - kept - 1;
+  size_t n = fread(lx->buf + kept, sizeof(char), wanted, lx->fis);
+  if (n < wanted) {
+    if (ferror(lx->fis)) {
+      throwError("Cannot read the input");
+    }
+    lx->eof = true;
+  }
+  lx->bufLen = kept + n;
+  lx->buf[lx->bufLen] = '\0';
+  lx->pch = lx->buf;
+
+  lx->lastNl = NULL;
+  for (const char *p = lx->buf + lx->bufLen; p > lx->buf;) {
+    if (*--p == '\n') {
+      lx->lastNl = p;
       break;
-    default:
-      pch = handle_default(pch);
     }
   }
 }
+
+// Returns true if the token from lx->pch might continue after the chars
+// from buf. Only a STRING can span lines and a CHAR looks at most 3 chars
+// ahead, so all the other tokens end before the last '\n'.
+bool needsInput(Lexer *lx) {
+  if (lx->eof) {
+    return false;
+  }
+  if (!lx->lastNl || lx->pch + 3 > lx->lastNl) {
+    return true;
+  }
+  return *lx->pch == '"' && *findChar(lx->pch + 1, '"') != '"';
+}
+
+Token *nextToken(Lexer *lx) {
+  crtLexer = lx;
+  int idx = lx->nTokens;
+  while (lx->nTokens == idx) {
+    if (needsInput(lx)) {
+      refill(lx);
+      continue;
+    }
+    const char *pch = lexStep(lx->pch);
+    // after END the lexer stays at the end of input
+    if (pch) {
+      lx->pch = pch;
+    }
+  }
+  crtLexer = NULL;
+  return windowToken(lx, idx);
+}
+
+Token *lexerToken(Lexer *lx, int idx) {
+  if (idx < lx->firstIdx) {
+    throwError("The token %d was already released", idx);
+  }
+  while (idx >= lx->nTokens) {
+    nextToken(lx);
+  }
+  return windowToken(lx, idx);
+}
+
+void lexerRelease(Lexer *lx, int idx) {
+  int nFree = (idx - lx->firstIdx) >> BLOCK_BITS;
+  if (nFree <= 0) {
+    return;
+  }
+  for (int i = 0; i < nFree; i++) {
+    free(lx->blocks[i]);
+  }
+  lx->nBlocks -= nFree;
+  memmove(lx->blocks, lx->blocks + nFree, lx->nBlocks * sizeof(Token *));
+  lx->firstIdx += nFree * BLOCK_TOKENS;
+}
+
 const char *getTokenString(int token) {
   switch (token) {
   case ID:
@@ -337,19 +774,28 @@ const char *getTokenString(int token) {
     return "UNKNOWN";
   }
 }
+void showToken(FILE *fout, const Token *tk) {
+  const char *label = getTokenString(tk->code);
+  fprintf(fout, "%d\t%s", tk->line, label);
+  if (tk->code == ID || tk->code == STRING) {
+    fprintf(fout, ":%.*s", tk->len, tk->text);
+  } else if (tk->code == INT) {
+    fprintf(fout, ":%d", tk->i);
+  } else if (tk->code == DOUBLE) {
+    fprintf(fout, ":%f", tk->d);
+  } else if (tk->code == CHAR) {
+    fprintf(fout, ":%c", tk->c);
+  }
+  fprintf(fout, "\n");
+}
+
 void showTokens(const Token *tokens) {
-  for (const Token *tk = tokens; tk; tk = tk->next) {
-    const char *label = getTokenString(tk->code);
-    printf("%d\t%s", tk->line, label);
-    if (tk->code == ID || tk->code == STRING) {
-      printf(":%s", tk->text);
-    } else if (tk->code == INT) {
-      printf(":%d", tk->i);
-    } else if (tk->code == DOUBLE) {
-      printf(":%f", tk->d);
-    } else if (tk->code == CHAR) {
-      printf(":%c", tk->c);
+  for (const Token *tk = tokens;; tk++) {
+    showToken(stdout, tk);
+    if (tk->code == END) {
+      break;
     }
-    printf("\n");
   }
 }
+
+void freeTokens(Token *tokens) { free(tokens); }
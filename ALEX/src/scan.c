@@ -0,0 +1,132 @@
+#include <stdint.h>
+
+#include "scan.h"
+
+#if defined(__SSE2__) && defined(__GNUC__)
+
+#include <emmintrin.h>
+
+// the kernels load only 16 bytes aligned blocks, so a load never crosses a
+// page boundary: the block with the terminating '\0' is the last one read
+
+// the last block may extend after the end of the allocated buffer, which is
+// safe but it is reported by AddressSanitizer
+// GCC defines __SANITIZE_ADDRESS__, clang reports it by __has_feature
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+#endif
+#if !defined(NO_SANITIZE_ADDRESS) && defined(__SANITIZE_ADDRESS__)
+#define NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+#ifndef NO_SANITIZE_ADDRESS
+#define NO_SANITIZE_ADDRESS
+#endif
+
+// returns the mask of the chars from block which end the scanning
+typedef unsigned (*StopMask)(__m128i block, __m128i ch);
+
+// scans from pch for the first char in stopMask
+NO_SANITIZE_ADDRESS static inline const char *scan(const char *pch, StopMask stopMask,
+                               __m128i ch) {
+  const char *p = (const char *)((uintptr_t)pch & ~(uintptr_t)15);
+  // ignore the chars from the first block which are before pch
+  unsigned mask = stopMask(_mm_load_si128((const __m128i *)p), ch) &
+                  (0xFFFFu << (pch - p));
+  while (!mask) {
+    p += 16;
+    mask = stopMask(_mm_load_si128((const __m128i *)p), ch);
+  }
+  return p + __builtin_ctz(mask);
+}
+
+static inline __m128i eq(__m128i block, char c) {
+  return _mm_cmpeq_epi8(block, _mm_set1_epi8(c));
+}
+
+// true for lo <= c <= hi, only for ASCII bounds (signed compare)
+static inline __m128i inRange(__m128i block, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(lo - 1)),
+                       _mm_cmplt_epi8(block, _mm_set1_epi8(hi + 1)));
+}
+
+static inline unsigned notSpaceMask(__m128i block, __m128i ch) {
+  (void)ch;
+  __m128i space = _mm_or_si128(eq(block, ' '), eq(block, '\t'));
+  return ~(unsigned)_mm_movemask_epi8(space) & 0xFFFFu;
+}
+
+static inline unsigned notIdMask(__m128i block, __m128i ch) {
+  (void)ch;
+  // 'A'..'Z' | 0x20 gives 'a'..'z', so both cases are tested with one range
+  __m128i lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+  __m128i id = _mm_or_si128(inRange(lower, 'a', 'z'), inRange(block, '0', '9'));
+  id = _mm_or_si128(id, eq(block, '_'));
+  return ~(unsigned)_mm_movemask_epi8(id) & 0xFFFFu;
+}
+
+static inline unsigned charMask(__m128i block, __m128i ch) {
+  __m128i found = _mm_or_si128(_mm_cmpeq_epi8(block, ch), eq(block, '\0'));
+  return (unsigned)_mm_movemask_epi8(found);
+}
+
+static inline unsigned commentEndMask(__m128i block, __m128i ch) {
+  (void)ch;
+  __m128i found = _mm_or_si128(eq(block, '\n'), eq(block, '\t'));
+  found = _mm_or_si128(found, eq(block, '\0'));
+  return (unsigned)_mm_movemask_epi8(found);
+}
+
+const char *skipSpaces(const char *pch) {
+  return scan(pch, notSpaceMask, _mm_setzero_si128());
+}
+
+const char *skipIdChars(const char *pch) {
+  return scan(pch, notIdMask, _mm_setzero_si128());
+}
+
+const char *findChar(const char *pch, char ch) {
+  return scan(pch, charMask, _mm_set1_epi8(ch));
+}
+
+const char *findCommentEnd(const char *pch) {
+  return scan(pch, commentEndMask, _mm_setzero_si128());
+}
+
+#else
+
+static int isIdChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || c == '_';
+}
+
+const char *skipSpaces(const char *pch) {
+  while (*pch == ' ' || *pch == '\t') {
+    ++pch;
+  }
+  return pch;
+}
+
+const char *skipIdChars(const char *pch) {
+  while (isIdChar(*pch)) {
+    ++pch;
+  }
+  return pch;
+}
+
+const char *findChar(const char *pch, char ch) {
+  while (*pch != ch && *pch != '\0') {
+    ++pch;
+  }
+  return pch;
+}
+
+const char *findCommentEnd(const char *pch) {
+  while (*pch != '\n' && *pch != '\t' && *pch != '\0') {
+    ++pch;
+  }
+  return pch;
+}
+
+#endif
@@ -0,0 +1,323 @@
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "intern.h"
+#include "tokcache.h"
+#include "utils.h"
+
+#define CACHE_MAGIC "ATKC"
+#define CACHE_VERSION 1 // must be changed when the lexer or the format changes
+
+// The cache file has a header, then the tokens and then the distinct texts
+// of IDs and STRINGs, each as its length followed by its chars.
+typedef struct {
+  char magic[4];    // CACHE_MAGIC
+  uint32_t version; // CACHE_VERSION
+  uint64_t srcHash; // the hash of the source
+  uint64_t srcLen;  // the number of chars from the source
+  uint32_t nTokens; // the number of tokens, including END
+  uint32_t nTexts;  // the number of distinct texts
+} CacheHeader;
+
+// A token as it is stored in the cache file.
+typedef struct {
+  int32_t code;
+  int32_t line;
+  union {
+    uint32_t text; // the index of the text for ID, STRING
+    int32_t i;     // the value for INT
+    char c;        // the value for CHAR
+    double d;      // the value for DOUBLE
+  };
+} CachedToken;
+
+// The distinct texts of the tokens, in the order of their first use.
+// The texts are atoms, so they are found by pointer in an open addressing
+// hash table.
+typedef struct {
+  const char **slots;  // the atoms, NULL for the empty slots
+  uint32_t *indexes;   // the index in texts of the atom from each slot
+  size_t mask;         // the number of slots minus 1, the slots are a power of 2
+  const Token **texts; // the first token which has each text
+  uint32_t nTexts;     // the number of distinct texts
+} TextIndex;
+
+// Hashes 8 chars at a time, with a final mix so all the bits count.
+uint64_t hashSource(const char *pch, size_t len) {
+  uint64_t h = 0x9E3779B97F4A7C15ull ^ len;
+  size_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint64_t w;
+    memcpy(&w, pch + i, 8);
+    h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+    h ^= h >> 29;
+  }
+  for (; i < len; i++) {
+    h = (h ^ (unsigned char)pch[i]) * 0x100000001B3ull;
+  }
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+// Returns the index of the text of tk, adding it if it is new.
+uint32_t textIndex(TextIndex *ti, const Token *tk) {
+  size_t slot = atomHash(tk->text) & ti->mask;
+  while (ti->slots[slot]) {
+    if (ti->slots[slot] == tk->text) {
+      return ti->indexes[slot];
+    }
+    slot = (slot + 1) & ti->mask;
+  }
+  ti->slots[slot] = tk->text;
+  ti->indexes[slot] = ti->nTexts;
+  ti->texts[ti->nTexts] = tk;
+  return ti->nTexts++;
+}
+
+// Writes the tokens in a temporary file, which is renamed to path only
+// when complete, so a concurrent compilation never reads a partial cache.
+void saveTokens(const char *path, const Token *tokens, uint64_t hash,
+                size_t len) {
+  uint32_t nTokens = 1;
+  while (tokens[nTokens - 1].code != END) {
+    nTokens++;
+  }
+
+  size_t nSlots = 16;
+  while (nSlots < 2 * (size_t)nTokens) {
+    nSlots *= 2;
+  }
+  TextIndex ti = {(const char **)safeAlloc(nSlots * sizeof(const char *)),
+                  (uint32_t *)safeAlloc(nSlots * sizeof(uint32_t)), nSlots - 1,
+                  (const Token **)safeAlloc(nTokens * sizeof(const Token *)),
+                  0};
+  memset(ti.slots, 0, nSlots * sizeof(const char *));
+
+  size_t tmpSize = strlen(path) + 32;
+  char *tmpPath = (char *)safeAlloc(tmpSize);
+  snprintf(tmpPath, tmpSize, "%s.%ld.tmp", path, (long)getpid());
+  FILE *fout = fopen(tmpPath, "wb");
+  if (fout) {
+    CacheHeader header = {"", CACHE_VERSION, hash, len, nTokens, 0};
+    memcpy(header.magic, CACHE_MAGIC, 4);
+    fwrite(&header, sizeof(header), 1, fout);
+    for (uint32_t i = 0; i < nTokens; i++) {
+      const Token *tk = &tokens[i];
+      CachedToken ct;
+      memset(&ct, 0, sizeof(ct));
+      ct.code = tk->code;
+      ct.line = tk->line;
+      if (tk->code == ID || tk->code == STRING) {
+        ct.text = textIndex(&ti, tk);
+      } else if (tk->code == INT) {
+        ct.i = tk->i;
+      } else if (tk->code == CHAR) {
+        ct.c = tk->c;
+      } else if (tk->code == DOUBLE) {
+        ct.d = tk->d;
+      }
+      fwrite(&ct, sizeof(ct), 1, fout);
+    }
+    for (uint32_t i = 0; i < ti.nTexts; i++) {
+      uint32_t textLen = (uint32_t)ti.texts[i]->len;
+      fwrite(&textLen, sizeof(textLen), 1, fout);
+      fwrite(ti.texts[i]->text, sizeof(char), textLen, fout);
+    }
+    // the number of texts is known only at the end
+    header.nTexts = ti.nTexts;
+    fseek(fout, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, fout);
+
+    bool written = !ferror(fout);
+    if (fclose(fout) == 0 && written) {
+#ifdef _WIN32
+      remove(path); // rename doesn't replace an existing file
+#endif
+      rename(tmpPath, path);
+    }
+    remove(tmpPath);
+  }
+
+  free(tmpPath);
+  free(ti.slots);
+  free(ti.indexes);
+  free(ti.texts);
+}
+
+// Rebuilds the tokens from the content of a cache file.
+// Returns NULL if the content is not a valid cache for the source.
+Token *decodeTokens(const char *buf, size_t size, uint64_t hash, size_t len) {
+  CacheHeader header;
+  if (size < sizeof(header)) {
+    return NULL;
+  }
+  memcpy(&header, buf, sizeof(header));
+  if (memcmp(header.magic, CACHE_MAGIC, 4) != 0 ||
+      header.version != CACHE_VERSION || header.srcHash != hash ||
+      header.srcLen != len || header.nTokens == 0 ||
+      (size - sizeof(header)) / sizeof(CachedToken) < header.nTokens) {
+    return NULL;
+  }
+
+  // Intern the texts
+  // the file is not trusted, so nTexts is checked before the texts are
+  // allocated: each text takes at least its length from the file
+  const char *pch =
+      buf + sizeof(header) + (size_t)header.nTokens * sizeof(CachedToken);
+  const char *end = buf + size;
+  if ((size_t)header.nTexts > (size_t)(end - pch) / sizeof(uint32_t)) {
+    return NULL;
+  }
+  const char **texts = (const char **)safeAlloc(
+      ((size_t)header.nTexts + 1) * sizeof(const char *));
+  int *lens = (int *)safeAlloc(((size_t)header.nTexts + 1) * sizeof(int));
+  Token *tokens = (Token *)safeAlloc(header.nTokens * sizeof(Token));
+  bool valid = true;
+  for (uint32_t i = 0; valid && i < header.nTexts; i++) {
+    uint32_t textLen;
+    if (end - pch < (ptrdiff_t)sizeof(textLen)) {
+      valid = false;
+      break;
+    }
+    memcpy(&textLen, pch, sizeof(textLen));
+    pch += sizeof(textLen);
+    if ((size_t)(end - pch) < textLen || textLen > INT_MAX) {
+      valid = false;
+      break;
+    }
+    texts[i] = intern(pch, (int)textLen);
+    lens[i] = (int)textLen;
+    pch += textLen;
+  }
+
+  const CachedToken *ct = (const CachedToken *)(buf + sizeof(header));
+  for (uint32_t i = 0; valid && i < header.nTokens; i++, ct++) {
+    Token *tk = &tokens[i];
+    // END must be the last token and only there
+    if (ct->code < ID || ct->code > STRING ||
+        (ct->code == END) != (i == header.nTokens - 1)) {
+      valid = false;
+      break;
+    }
+    tk->code = ct->code;
+    tk->line = ct->line;
+    if (ct->code == ID || ct->code == STRING) {
+      if (ct->text >= header.nTexts) {
+        valid = false;
+        break;
+      }
+      tk->text = texts[ct->text];
+      tk->len = lens[ct->text];
+    } else if (ct->code == INT) {
+      tk->i = ct->i;
+    } else if (ct->code == CHAR) {
+      tk->c = ct->c;
+    } else if (ct->code == DOUBLE) {
+      tk->d = ct->d;
+    }
+  }
+
+  free(texts);
+  free(lens);
+  if (!valid) {
+    free(tokens);
+    return NULL;
+  }
+  return tokens;
+}
+
+// Returns the tokens from the cache file path, or NULL if there is no
+// valid cache for the source in it.
+Token *loadTokens(const char *path, uint64_t hash, size_t len) {
+  FILE *fis = fopen(path, "rb");
+  if (!fis) {
+    return NULL;
+  }
+  fclose(fis);
+
+  size_t size;
+  const char *buf = mapFile(path, &size);
+  Token *tokens = decodeTokens(buf, size, hash, len);
+  unmapFile(buf, size);
+  return tokens;
+}
+
+bool sameToken(const Token *a, const Token *b) {
+  if (a->code != b->code || a->line != b->line) {
+    return false;
+  }
+  switch (a->code) {
+  case ID:
+  case STRING:
+    return a->text == b->text && a->len == b->len;
+  case INT:
+    return a->i == b->i;
+  case CHAR:
+    return a->c == b->c;
+  case DOUBLE:
+    return memcmp(&a->d, &b->d, sizeof(double)) == 0;
+  default:
+    return true;
+  }
+}
+
+void verifyTokens(const Token *lexed, const Token *cached) {
+  for (int i = 0;; i++) {
+    if (!sameToken(&lexed[i], &cached[i])) {
+      fprintf(stderr, "lexed:\t");
+      showToken(stderr, &lexed[i]);
+      fprintf(stderr, "cached:\t");
+      showToken(stderr, &cached[i]);
+      throwError("The cached token %d is different from the lexed one", i);
+    }
+    if (lexed[i].code == END) {
+      break;
+    }
+  }
+}
+
+Token *tokenizeCached(const char *pch, const char *cacheDir, int nThreads,
+                      bool verify) {
+  size_t len = strlen(pch);
+  uint64_t hash = hashSource(pch, len);
+  size_t pathSize = strlen(cacheDir) + 32;
+  char *path = (char *)safeAlloc(pathSize);
+  snprintf(path, pathSize, "%s/%016llx.tok", cacheDir,
+           (unsigned long long)hash);
+
+  Token *tokens = verify ? NULL : loadTokens(path, hash, len);
+  if (!tokens) {
+    tokens = tokenizeParallel(pch, len, nThreads);
+    Token *cached = verify ? loadTokens(path, hash, len) : NULL;
+    if (!cached) {
+      saveTokens(path, tokens, hash, len);
+    }
+    if (verify) {
+      // a new cache is verified by reading it back
+      if (!cached) {
+        cached = loadTokens(path, hash, len);
+      }
+      if (!cached) {
+        throwError("Cannot create the token cache %s", path);
+      }
+      verifyTokens(tokens, cached);
+      freeTokens(cached);
+    }
+  }
+
+  free(path);
+  return tokens;
+}
@@ -1,6 +1,19 @@
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include <sys/stat.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include "utils.h"
 
@@ -25,6 +38,14 @@ void *safeAlloc(size_t nBytes) {
   return p;
 }
 
+void *safeRealloc(void *p, size_t nBytes) {
+  p = realloc(p, nBytes);
+  if (!p) {
+    throwError("Not enough memory");
+  }
+  return p;
+}
+
 char *loadFile(const char *fileName) {
   // Opening file
   FILE *fis = fopen(fileName, "rb");
@@ -50,3 +71,209 @@ char *loadFile(const char *fileName) {
   buf[file_size] = '\0';
   return buf;
 }
+
+#ifdef _WIN32
+const char *mapFile(const char *fileName, size_t *size) {
+  char *buf = loadFile(fileName);
+  *size = 0; // always released with free
+  return buf;
+}
+
+void unmapFile(const char *buf, size_t size) { free((void *)buf); }
+#else
+// the file can be mapped only if its last page has room for the '\0' which
+// the kernel fills in after the end of file
+static bool canMapFile(size_t size) {
+  return size % (size_t)sysconf(_SC_PAGESIZE) != 0;
+}
+
+const char *mapFile(const char *fileName, size_t *size) {
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0) {
+    throwError("Unable to open %s", fileName);
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    throwError("Unable to get the size of %s", fileName);
+  }
+  *size = (size_t)st.st_size;
+
+  if (!canMapFile(*size)) {
+    close(fd);
+    return loadFile(fileName);
+  }
+
+  void *buf = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (buf == MAP_FAILED) {
+    throwError("Unable to map %s", fileName);
+  }
+  return (const char *)buf;
+}
+
+void unmapFile(const char *buf, size_t size) {
+  if (canMapFile(size)) {
+    munmap((void *)buf, size);
+  } else {
+    free((void *)buf);
+  }
+}
+#endif
+
+FileStamp fileStamp(const char *fileName) {
+  struct stat st;
+  if (stat(fileName, &st) < 0) {
+    return (FileStamp){-1, -1};
+  }
+#ifdef _WIN32
+  long long mtime = (long long)st.st_mtime * 1000000000;
+#else
+  long long mtime = (long long)st.st_mtim.tv_sec * 1000000000 +
+                    st.st_mtim.tv_nsec;
+#endif
+  return (FileStamp){mtime, (long long)st.st_size};
+}
+
+void sleepMs(int ms) {
+#ifdef _WIN32
+  Sleep(ms);
+#else
+  struct timespec ts = {ms / 1000, (ms % 1000) * 1000000L};
+  nanosleep(&ts, NULL);
+#endif
+}
+
+void *reserveMemory(size_t size) {
+#ifdef _WIN32
+  void *p = VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+  if (!p) {
+    throwError("Unable to reserve %zu bytes", size);
+  }
+#else
+  void *p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (p == MAP_FAILED) {
+    throwError("Unable to reserve %zu bytes", size);
+  }
+#endif
+  return p;
+}
+
+void commitMemory(void *p, size_t size) {
+#ifdef _WIN32
+  if (!VirtualAlloc(p, size, MEM_COMMIT, PAGE_READWRITE)) {
+    throwError("Unable to commit %zu bytes", size);
+  }
+#else
+  // Linux commits the pages when they are first used
+  (void)p;
+  (void)size;
+#endif
+}
+
+void zeroMemory(void *p, size_t size) {
+#ifdef _WIN32
+  size_t pageSize = 4096;
+#else
+  size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+#endif
+  char *begin = (char *)p;
+  char *end = begin + size;
+  // the pages which are only partly in [begin, end) are written
+  char *firstPage = (char *)(((size_t)begin + pageSize - 1) & ~(pageSize - 1));
+  char *lastPage = (char *)((size_t)end & ~(pageSize - 1));
+  if (firstPage >= lastPage) {
+    memset(begin, 0, size);
+    return;
+  }
+  memset(begin, 0, firstPage - begin);
+  memset(lastPage, 0, end - lastPage);
+#ifdef _WIN32
+  // a page committed again is zeroed
+  VirtualFree(firstPage, lastPage - firstPage, MEM_DECOMMIT);
+  VirtualAlloc(firstPage, lastPage - firstPage, MEM_COMMIT, PAGE_READWRITE);
+#else
+  // the private anonymous pages read as zero after they are discarded
+  madvise(firstPage, lastPage - firstPage, MADV_DONTNEED);
+#endif
+}
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+struct ArenaBlock {
+  ArenaBlock *next;
+  size_t size; // the size of data
+  max_align_t data[];
+};
+
+void *arenaAlloc(Arena *arena, size_t nBytes) {
+  nBytes = (nBytes + sizeof(max_align_t) - 1) & ~(sizeof(max_align_t) - 1);
+  if ((size_t)(arena->end - arena->free) < nBytes) {
+    ArenaBlock *b = arena->spare;
+    if (b && b->size >= nBytes) {
+      arena->spare = NULL;
+    } else {
+      size_t size = nBytes > ARENA_BLOCK_SIZE ? nBytes : ARENA_BLOCK_SIZE;
+      b = (ArenaBlock *)safeAlloc(sizeof(ArenaBlock) + size);
+      b->size = size;
+    }
+    b->next = arena->blocks;
+    arena->blocks = b;
+    arena->free = (char *)b->data;
+    arena->end = arena->free + b->size;
+  }
+  void *p = arena->free;
+  arena->free += nBytes;
+  return p;
+}
+
+void arenaReset(Arena *arena) {
+  if (!arena->blocks) {
+    return;
+  }
+  // the first allocated block is the last from the list
+  while (arena->blocks->next) {
+    ArenaBlock *b = arena->blocks;
+    arena->blocks = b->next;
+    free(b);
+  }
+  arena->free = (char *)arena->blocks->data;
+  arena->end = arena->free + arena->blocks->size;
+}
+
+void arenaFree(Arena *arena) {
+  while (arena->blocks) {
+    ArenaBlock *b = arena->blocks;
+    arena->blocks = b->next;
+    free(b);
+  }
+  free(arena->spare);
+  arena->spare = NULL;
+  arena->free = arena->end = NULL;
+}
+
+ArenaMark arenaMark(Arena *arena) {
+  return (ArenaMark){arena->blocks, arena->free};
+}
+
+void arenaRelease(Arena *arena, ArenaMark mark) {
+  // the block after mark is kept, so a region which is pushed and released
+  // again and again at the end of a block doesn't allocate a new block
+  while (arena->blocks != mark.block) {
+    ArenaBlock *b = arena->blocks;
+    arena->blocks = b->next;
+    if (b->next == mark.block && mark.block && !arena->spare) {
+      arena->spare = b;
+    } else {
+      free(b);
+    }
+  }
+  if (!mark.block) {
+    arenaFree(arena);
+    return;
+  }
+  arena->free = mark.free;
+  arena->end = (char *)mark.block->data + mark.block->size;
+}
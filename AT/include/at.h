@@ -20,12 +20,16 @@ bool canBeScalar(Ret *r);
 // if yes, returns true
 bool convTo(Type *src, Type *dst);
 
+// returns the VM instruction which converts a value of type src, which can be
+// converted to dst, to a value of type dst; OP_NOP if no instruction is needed
+Opcode convOp(Type *src, Type *dst);
+
 // sets in dst the resulted type of an arithmetic operation
 // having as operands the types t1 and t2
 // returns true if t1 and t2 can be operands for an arithmetic operation
 // ex: double + int -> double
 bool arithTypeTo(Type *t1, Type *t2, Type *dst);
 
-// searches a name in a list of symbols
+// searches an interned name in a list of symbols
 // if it finds it, returns the correspondent symbol, else NULL
-Symbol *findSymbolInList(Symbol *list, const char *name);
+Symbol *findSymbolInList(SymbolList *list, const char *name);
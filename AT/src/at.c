@@ -2,94 +2,129 @@
 #include <string.h>
 
 
-bool canBeScalar(Ret *r) {
-  Type *t = &r->type;
-  if (t->n >= 0)
-    return false;
-  if (t->tb == TB_VOID)
-    return false;
-  return true;
-}
+// The types are grouped in classes, which decide how they are converted:
+// a class for each base type and one for all the arrays, which are
+// converted as pointers. The conversions between classes are in tables,
+// so the checks of the operands and arguments are lookups.
+typedef enum {
+  TC_INT,
+  TC_DOUBLE,
+  TC_CHAR,
+  TC_VOID,
+  TC_STRUCT,
+  TC_ARRAY,
+  TC_COUNT // the number of classes, the size of each table dimension
+} TypeClass;
 
-bool convTo(Type *src, Type *dst) {
-  // the pointers (arrays) can be converted one to another, but in nothing else
-  if (src->n >= 0) {
-    if (dst->n >= 0)
-      return true;
-    return false;
-  }
-  if (dst->n >= 0)
-    return false;
-  switch (src->tb) {
+// returns the class of t, which is always less than TC_COUNT, so it can
+// index the tables
+// a new base type must get its class here, else it stops the compiler
+TypeClass typeClass(Type *t) {
+  if (t->n >= 0)
+    return TC_ARRAY;
+  switch (t->tb) {
   case TB_INT:
+    return TC_INT;
   case TB_DOUBLE:
+    return TC_DOUBLE;
   case TB_CHAR:
-    switch (dst->tb) {
-    case TB_INT:
-    case TB_CHAR:
-    case TB_DOUBLE:
-      return true;
-    default:
-      return false;
-    }
-  // a struct can be converted only to itself
+    return TC_CHAR;
+  case TB_VOID:
+    return TC_VOID;
   case TB_STRUCT:
-    if (dst->tb == TB_STRUCT && src->s == dst->s)
-      return true;
+    return TC_STRUCT;
+  }
+  throwError("typeClass: no class for the type base %d", t->tb);
+}
+
+// indexed by the class of a type: true if its values can be scalars
+static const bool scalarClasses[TC_COUNT] = {[TC_INT] = true,
+                                             [TC_DOUBLE] = true,
+                                             [TC_CHAR] = true,
+                                             [TC_STRUCT] = true};
+
+// how a value is converted, CONV_NONE if it cannot be
+typedef enum {
+  CONV_NONE,  // it cannot be converted
+  CONV_SAME,  // it is used as it is
+  CONV_I_F,   // by OP_CONV_I_F
+  CONV_F_I,   // by OP_CONV_F_I
+  CONV_STRUCT // only if it is the same struct
+} Conv;
+
+// indexed by [the class of the source][the class of the destination]
+// the missing pairs are CONV_NONE
+static const Conv convs[TC_COUNT][TC_COUNT] = {
+    [TC_INT] = {[TC_INT] = CONV_SAME, [TC_DOUBLE] = CONV_I_F,
+                [TC_CHAR] = CONV_SAME},
+    [TC_DOUBLE] = {[TC_INT] = CONV_F_I, [TC_DOUBLE] = CONV_SAME,
+                   [TC_CHAR] = CONV_SAME},
+    [TC_CHAR] = {[TC_INT] = CONV_SAME, [TC_DOUBLE] = CONV_SAME,
+                 [TC_CHAR] = CONV_SAME},
+    [TC_STRUCT] = {[TC_STRUCT] = CONV_STRUCT},
+    [TC_ARRAY] = {[TC_ARRAY] = CONV_SAME}};
+
+// the base type of the result of an arithmetic operation, ARITH_NONE if
+// its operands cannot be used in it
+typedef enum { ARITH_NONE, ARITH_INT, ARITH_DOUBLE, ARITH_CHAR } Arith;
+
+// indexed by [the class of the left operand][the class of the right one]
+// the missing pairs are ARITH_NONE
+static const Arith ariths[TC_COUNT][TC_COUNT] = {
+    [TC_INT] = {[TC_INT] = ARITH_INT, [TC_DOUBLE] = ARITH_DOUBLE,
+                [TC_CHAR] = ARITH_INT},
+    [TC_DOUBLE] = {[TC_INT] = ARITH_DOUBLE, [TC_DOUBLE] = ARITH_DOUBLE,
+                   [TC_CHAR] = ARITH_DOUBLE},
+    [TC_CHAR] = {[TC_INT] = ARITH_INT, [TC_DOUBLE] = ARITH_DOUBLE,
+                 [TC_CHAR] = ARITH_CHAR}};
+
+bool canBeScalar(Ret *r) { return scalarClasses[typeClass(&r->type)]; }
+
+bool convTo(Type *src, Type *dst) {
+  switch (convs[typeClass(src)][typeClass(dst)]) {
+  case CONV_NONE:
     return false;
+  case CONV_STRUCT:
+    return src->s == dst->s;
   default:
-    return false;
+    return true;
+  }
+}
+
+Opcode convOp(Type *src, Type *dst) {
+  switch (convs[typeClass(src)][typeClass(dst)]) {
+  case CONV_I_F:
+    return OP_CONV_I_F;
+  case CONV_F_I:
+    return OP_CONV_F_I;
+  default:
+    return OP_NOP;
   }
 }
 
 bool arithTypeTo(Type *t1, Type *t2, Type *dst) {
-  // there are no arithmetic operations with pointers
-  if (t1->n >= 0 || t2->n >= 0)
+  switch (ariths[typeClass(t1)][typeClass(t2)]) {
+  case ARITH_INT:
+    dst->tb = TB_INT;
+    break;
+  case ARITH_DOUBLE:
+    dst->tb = TB_DOUBLE;
+    break;
+  case ARITH_CHAR:
+    dst->tb = TB_CHAR;
+    break;
+  default:
     return false;
+  }
   // the result of an arithmetic operation cannot be pointer or struct
   dst->s = NULL;
   dst->n = -1;
-  switch (t1->tb) {
-  case TB_INT:
-    switch (t2->tb) {
-    case TB_INT:
-    case TB_CHAR:
-      dst->tb = TB_INT;
-      return true;
-    case TB_DOUBLE:
-      dst->tb = TB_DOUBLE;
-      return true;
-    default:
-      return false;
-    }
-  case TB_DOUBLE:
-    switch (t2->tb) {
-    case TB_INT:
-    case TB_DOUBLE:
-    case TB_CHAR:
-      dst->tb = TB_DOUBLE;
-      return true;
-    default:
-      return false;
-    }
-  case TB_CHAR:
-    switch (t2->tb) {
-    case TB_INT:
-    case TB_DOUBLE:
-    case TB_CHAR:
-      dst->tb = t2->tb;
-      return true;
-    default:
-      return false;
-    }
-  default:
-    return false;
-  }
+  return true;
 }
 
-Symbol *findSymbolInList(Symbol *list, const char *name) {
-  for (Symbol *s = list; s; s = s->next) {
-    if (!strcmp(s->name, name))
+Symbol *findSymbolInList(SymbolList *list, const char *name) {
+  for (Symbol *s = list->first; s; s = s->next) {
+    if (s->name == name)
       return s;
   }
   return NULL;
@@ -0,0 +1,50 @@
+#pragma once
+
+// the typed abstract syntax tree of the function bodies
+// it is built by the parser, which also does the type analysis,
+// and the code is generated from it by genFn
+
+#include "at.h"
+#include "utils.h"
+
+typedef enum{
+	// expressions
+	AST_VAR,		// a global variable: sym
+	AST_LOCAL,		// a local variable or a parameter: i is its offset from FP
+	AST_INT,		// i
+	AST_DOUBLE,		// d
+	AST_CONST,		// an operand without code: a CHAR, a STRING or a struct name
+	AST_CALL,		// the function sym with the arguments list
+	AST_INDEX,		// left[right]
+	AST_FIELD,		// left.sym
+	AST_UNARY,		// op left, with op SUB or NOT
+	AST_CAST,		// (r.type)left
+	AST_BINARY,		// left op right
+	AST_ASSIGN,		// left=right
+	// statements
+	AST_BLOCK,		// the statements from list
+	AST_IF,			// if(left)right else elseStm
+	AST_WHILE,		// while(left)right
+	AST_RETURN,		// return left, left can be NULL
+	AST_EXPR,		// left;
+	AST_EMPTY		// ;
+	}AstKind;
+
+typedef struct Ast Ast;
+struct Ast{
+	AstKind kind;
+	int op;				// AST_UNARY, AST_BINARY: the token code of the operator
+	Ret r;				// for an expression, the result of its type analysis
+	union{
+		int i;			// AST_INT
+		double d;		// AST_DOUBLE
+		Symbol *sym;	// AST_VAR, AST_CALL, AST_FIELD
+		};
+	Ast *left,*right;	// the operands or the parts of a statement, see AstKind
+	Ast *elseStm;		// AST_IF: the else statement or NULL
+	Ast *list;			// AST_BLOCK: the statements, AST_CALL: the arguments
+	Ast *next;			// the next node from a list
+	};
+
+// allocates a node from arena, with all its fields 0
+Ast *newAst(Arena *arena,AstKind kind);
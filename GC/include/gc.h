@@ -2,12 +2,33 @@
 
 // code generation
 
+#include "ast.h"
 #include "at.h"
 #include "vm.h"
 
-// inserts after the specified instruction a conversion instruction
+// inserts in code after the specified instruction a conversion instruction
 // only if necessary
-void insertConvIfNeeded(Instr *before,Type *srcType,Type *dstType);
+void insertConvIfNeeded(InstrList *code,Instr *before,Type *srcType,Type *dstType);
 
 // if lval is true, generates an rval from the current value from stack
-void addRVal(Instr **code,bool lval,Type *type);
+void addRVal(InstrList *code,bool lval,Type *type);
+
+// the offset from FP of a local variable or of a parameter
+int fpOffset(Symbol *s);
+
+// generates the code of the function fn from its body, which is an AST_BLOCK
+// the OP_CALL instructions keep the called function in arg.p, until linkCalls
+// the functions can be generated in parallel, each on its own thread
+void genFn(Symbol *fn,Ast *body);
+
+// sets the target of the OP_CALL instructions from the code of fn, after
+// the code of all the called functions was generated
+void linkCalls(Symbol *fn);
+
+// moves the first instruction of the new code of fn in entry, which was the
+// first instruction of its old code, so the calls linked to the old code
+// call the new one
+void keepFnEntry(Symbol *fn,Instr *entry);
+
+// frees the memory used by the code generation on the current thread
+void genRelease();
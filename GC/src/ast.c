@@ -0,0 +1,9 @@
+#include <string.h>
+#include "ast.h"
+
+Ast *newAst(Arena *arena,AstKind kind){
+	Ast *a=(Ast*)arenaAlloc(arena,sizeof(Ast));
+	memset(a,0,sizeof(Ast));
+	a->kind=kind;
+	return a;
+	}
@@ -1,25 +1,14 @@
+#include <stdlib.h>
+
 #include "gc.h"
+#include "lexer.h"
 
-void insertConvIfNeeded(Instr *before,Type *srcType,Type *dstType){
-	switch(srcType->tb){
-		case TB_INT:
-			switch(dstType->tb){
-				case TB_DOUBLE:
-					insertInstr(before,OP_CONV_I_F);
-					break;
-				}
-			break;
-		case TB_DOUBLE:
-			switch(dstType->tb){
-				case TB_INT:
-					insertInstr(before,OP_CONV_F_I);
-					break;
-				}
-			break;
-		}
+void insertConvIfNeeded(InstrList *code,Instr *before,Type *srcType,Type *dstType){
+	Opcode op=convOp(srcType,dstType);
+	if(op!=OP_NOP)insertInstr(code,before,op);
 	}
 
-void addRVal(Instr **code,bool lval,Type *type){
+void addRVal(InstrList *code,bool lval,Type *type){
 	if(!lval)return;
 	switch(type->tb){
 		case TB_INT:
@@ -30,3 +19,227 @@ void addRVal(Instr **code,bool lval,Type *type){
 			break;
 		}
 	}
+
+// an expression node during the generation of its code
+typedef struct{
+	Ast *e;
+	int state;			// how many operands of e have the code generated
+	Instr *lastLeft;	// AST_BINARY: the last instruction before the rvalue of left
+	Ast *arg;			// AST_CALL: the argument which has the code generated
+	Symbol *param;		// AST_CALL: the parameter of arg
+	}GenFrame;
+
+// the stack of genExpr, so deep expressions don't use the C stack
+_Thread_local GenFrame *genFrames=NULL;
+_Thread_local int nGenFrames=0,capGenFrames=0;
+
+void pushGenFrame(Ast *e){
+	if(nGenFrames==capGenFrames){
+		capGenFrames=capGenFrames?capGenFrames*2:64;
+		genFrames=(GenFrame*)safeRealloc(genFrames,capGenFrames*sizeof(GenFrame));
+		}
+	genFrames[nGenFrames++]=(GenFrame){e,0,NULL,NULL,NULL};
+	}
+
+int fpOffset(Symbol *s){
+	if(s->kind==SK_VAR)return s->varIdx+1;		// local variables
+	return s->paramIdx-s->owner->fn.params.n-1;		// SK_PARAM
+	}
+
+// generates the code of a binary operator, after the code of its operands
+void genBinary(InstrList *code,Ast *e,Instr *lastLeft){
+	Type tDst;
+	switch(e->op){
+		case EQUAL:case NOTEQ:case AND:case OR:
+			return;
+		}
+	arithTypeTo(&e->left->r.type,&e->right->r.type,&tDst);
+	addRVal(code,e->right->r.lval,&e->right->r.type);
+	// the conversion of the left operand is inserted before its rvalue
+	insertConvIfNeeded(code,lastLeft,&e->left->r.type,&tDst);
+	insertConvIfNeeded(code,lastInstr(code),&e->right->r.type,&tDst);
+	if(tDst.tb!=TB_INT&&tDst.tb!=TB_DOUBLE)return;
+	bool isInt=tDst.tb==TB_INT;
+	switch(e->op){		// only LESS from the relational operators
+		case MUL:addInstr(code,isInt?OP_MUL_I:OP_MUL_F);break;
+		case DIV:addInstr(code,isInt?OP_DIV_I:OP_DIV_F);break;
+		case ADD:addInstr(code,isInt?OP_ADD_I:OP_ADD_F);break;
+		case SUB:addInstr(code,isInt?OP_SUB_I:OP_SUB_F);break;
+		case LESS:addInstr(code,isInt?OP_LESS_I:OP_LESS_F);break;
+		}
+	}
+
+// generates the code which puts on stack the value of the expression e
+// an lvalue is left as an address, which addRVal converts to its value
+void genExpr(InstrList *code,Ast *e){
+	int base=nGenFrames;
+	pushGenFrame(e);
+	while(nGenFrames>base){
+		GenFrame *f=&genFrames[nGenFrames-1];
+		e=f->e;
+		switch(e->kind){
+			case AST_VAR:
+				addInstrWithInt(code,OP_ADDR,e->sym->varOffset);
+				break;
+			case AST_LOCAL:
+				switch(e->r.type.tb){
+					case TB_INT:addInstrWithInt(code,OP_FPADDR_I,e->i);break;
+					case TB_DOUBLE:addInstrWithInt(code,OP_FPADDR_F,e->i);break;
+					}
+				break;
+			case AST_INT:
+				addInstrWithInt(code,OP_PUSH_I,e->i);
+				break;
+			case AST_DOUBLE:
+				addInstrWithDouble(code,OP_PUSH_F,e->d);
+				break;
+			case AST_CONST:
+				break;
+			case AST_CALL:
+				if(f->state==0){
+					f->arg=e->list;
+					f->param=e->sym->fn.params.first;
+					}else{
+					addRVal(code,f->arg->r.lval,&f->arg->r.type);
+					insertConvIfNeeded(code,lastInstr(code),&f->arg->r.type,&f->param->type);
+					f->arg=f->arg->next;
+					f->param=f->param->next;
+					}
+				if(f->arg){
+					f->state++;
+					pushGenFrame(f->arg);
+					continue;
+					}
+				if(e->sym->fn.extFnPtr){
+					addInstr(code,OP_CALL_EXT)->arg.extFnPtr=e->sym->fn.extFnPtr;
+					}else{
+					// the called function can be generated later, see linkCalls
+					addInstr(code,OP_CALL)->arg.p=e->sym;
+					}
+				break;
+			case AST_FIELD:
+			case AST_UNARY:
+			case AST_CAST:
+				if(f->state++==0){
+					pushGenFrame(e->left);
+					continue;
+					}
+				break;
+			case AST_INDEX:
+			case AST_BINARY:
+			case AST_ASSIGN:
+				if(f->state==0){
+					f->state++;
+					pushGenFrame(e->left);
+					continue;
+					}
+				if(f->state==1){
+					f->state++;
+					if(e->kind==AST_BINARY&&e->op!=EQUAL&&e->op!=NOTEQ&&e->op!=AND&&e->op!=OR){
+						f->lastLeft=lastInstr(code);
+						addRVal(code,e->left->r.lval,&e->left->r.type);
+						}
+					pushGenFrame(e->right);
+					continue;
+					}
+				if(e->kind==AST_BINARY){
+					genBinary(code,e,f->lastLeft);
+					}else if(e->kind==AST_ASSIGN){
+					addRVal(code,e->right->r.lval,&e->right->r.type);
+					insertConvIfNeeded(code,lastInstr(code),&e->right->r.type,&e->left->r.type);
+					switch(e->left->r.type.tb){
+						case TB_INT:addInstr(code,OP_STORE_I);break;
+						case TB_DOUBLE:addInstr(code,OP_STORE_F);break;
+						}
+					}
+				break;
+			default:
+				break;
+			}
+		nGenFrames--;
+		}
+	}
+
+// generates the code of the expression cond, converted to int
+void genCond(InstrList *code,Ast *cond){
+	Type intType={TB_INT,NULL,-1};
+	genExpr(code,cond);
+	addRVal(code,cond->r.lval,&cond->r.type);
+	insertConvIfNeeded(code,lastInstr(code),&cond->r.type,&intType);
+	}
+
+void genStm(InstrList *code,Symbol *fn,Ast *s){
+	switch(s->kind){
+		case AST_BLOCK:
+			for(Ast *i=s->list;i;i=i->next)genStm(code,fn,i);
+			break;
+		case AST_IF:{
+			genCond(code,s->left);
+			Instr *ifJF=addInstr(code,OP_JF);
+			genStm(code,fn,s->right);
+			if(s->elseStm){
+				Instr *ifJMP=addInstr(code,OP_JMP);
+				ifJF->arg.instr=addInstr(code,OP_NOP);
+				genStm(code,fn,s->elseStm);
+				ifJMP->arg.instr=addInstr(code,OP_NOP);
+				}else{
+				ifJF->arg.instr=addInstr(code,OP_NOP);
+				}
+			}break;
+		case AST_WHILE:{
+			Instr *beforeWhileCond=lastInstr(code);
+			genCond(code,s->left);
+			Instr *whileJF=addInstr(code,OP_JF);
+			genStm(code,fn,s->right);
+			addInstr(code,OP_JMP)->arg.instr=beforeWhileCond->next;
+			whileJF->arg.instr=addInstr(code,OP_NOP);
+			}break;
+		case AST_RETURN:
+			if(s->left){
+				genExpr(code,s->left);
+				addRVal(code,s->left->r.lval,&s->left->r.type);
+				insertConvIfNeeded(code,lastInstr(code),&s->left->r.type,&fn->type);
+				addInstrWithInt(code,OP_RET,fn->fn.params.n);
+				}else{
+				addInstr(code,OP_RET_VOID);
+				}
+			break;
+		case AST_EXPR:
+			genExpr(code,s->left);
+			if(s->left->r.type.tb!=TB_VOID)addInstr(code,OP_DROP);
+			break;
+		default:		// AST_EMPTY
+			break;
+		}
+	}
+
+void genFn(Symbol *fn,Ast *body){
+	addInstrWithInt(&fn->fn.instr,OP_ENTER,fn->fn.locals.n);
+	genStm(&fn->fn.instr,fn,body);
+	if(fn->type.tb==TB_VOID){
+		addInstrWithInt(&fn->fn.instr,OP_RET_VOID,fn->fn.params.n);
+		}
+	}
+
+void linkCalls(Symbol *fn){
+	for(Instr *i=fn->fn.instr.first;i;i=i->next){
+		if(i->op==OP_CALL){
+			Symbol *called=(Symbol*)i->arg.p;
+			i->arg.instr=called->fn.instr.first;
+			}
+		}
+	}
+
+void keepFnEntry(Symbol *fn,Instr *entry){
+	Instr *first=fn->fn.instr.first;
+	*entry=*first;
+	if(fn->fn.instr.last==first)fn->fn.instr.last=entry;
+	fn->fn.instr.first=entry;
+	free(first);
+	}
+
+void genRelease(){
+	free(genFrames);
+	genFrames=NULL;
+	nGenFrames=capGenFrames=0;
+	}
@@ -37,7 +37,7 @@ typedef enum{
 	,OP_LOAD_F		// take an adress from stack and puts back the double value from that address
 	,OP_STORE_I		// takes from the stack an address and an int value and puts the value at the specified address. Leaves the value on stack.
 	,OP_STORE_F		// takes from the stack an address and a double value and puts the value at the specified address. Leaves the value on stack.
-	,OP_ADDR			// [p] pushes on stack the given pointer
+	,OP_ADDR			// [offset] pushes on stack the address of the global variable at offset in globalsMem
 	,OP_FPADDR_I		// [idx] pushes on stack the address of FP[idx].i
 	,OP_FPADDR_F		// [idx] pushes on stack the address of FP[idx].f
 	,OP_ADD_F				// adds 2 double values from stack and puts the result on stack
@@ -70,25 +70,33 @@ struct Instr{
 	Instr *next;		// the link to the next instruction in list
 	};
 
+// a list of instructions which keeps its last instruction, so all the
+// operations at its end are done in constant time
+typedef struct{
+	Instr *first;		// the first instruction, NULL for an empty list
+	Instr *last;		// the last instruction, NULL for an empty list
+	}InstrList;
+
 // adds a new instruction to the end of list and sets its "op" field
 // returns the newly added instruction
-Instr *addInstr(Instr **list,Opcode op);
+Instr *addInstr(InstrList *list,Opcode op);
 
-// inserts a new instruction after the specified instruction and sets its "op" field
+// inserts a new instruction in list after the specified instruction and sets its "op" field
 // returns the newly added instruction
-Instr *insertInstr(Instr *before,int op);
-
-// deletes all the instructions after the given one
-void delInstrAfter(Instr *instr);
+Instr *insertInstr(InstrList *list,Instr *before,int op);
 
 // returns the last instruction from list
-Instr *lastInstr(Instr *list);
+Instr *lastInstr(const InstrList *list);
+
+// deletes all the instructions from list after the checkpoint instruction,
+// or all of them if checkpoint is NULL
+void instrRollback(InstrList *list,Instr *checkpoint);
 
 // add an instruction which has an argument of type int
-Instr *addInstrWithInt(Instr **list,Opcode op,int argVal);
+Instr *addInstrWithInt(InstrList *list,Opcode op,int argVal);
 
 // add an instruction which has an argument of type double
-Instr *addInstrWithDouble(Instr **list,Opcode op,double argVal);
+Instr *addInstrWithDouble(InstrList *list,Opcode op,double argVal);
 
 // MV initialisation
 void vmInit();
@@ -96,5 +104,5 @@ void vmInit();
 // executes the code starting with the given instruction (IP - Instruction Pointer)
 void run(Instr *IP);
 
-// generates a test program
+// generates a test program and returns its first instruction
 Instr *genTestProgram();
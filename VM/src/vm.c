@@ -2,57 +2,57 @@
 #include <stdlib.h>
 
 #include "ad.h"
+#include "intern.h"
 #include "utils.h"
 
 
-Instr *addInstr(Instr **list, Opcode op) {
+Instr *addInstr(InstrList *list, Opcode op) {
   Instr *i = (Instr *)safeAlloc(sizeof(Instr));
   i->op = op;
   i->next = NULL;
-  if (*list) {
-    Instr *p = *list;
-    while (p->next)
-      p = p->next;
-    p->next = i;
+  if (list->last) {
+    list->last->next = i;
   } else {
-    *list = i;
+    list->first = i;
   }
+  list->last = i;
   return i;
 }
 
-Instr *insertInstr(Instr *before, int op) {
+Instr *insertInstr(InstrList *list, Instr *before, int op) {
   Instr *i = (Instr *)safeAlloc(sizeof(Instr));
   i->op = op;
   i->next = before->next;
   before->next = i;
+  if (list->last == before) {
+    list->last = i;
+  }
   return i;
 }
 
-void delInstrAfter(Instr *instr) {
-  if (!instr)
-    return;
-  for (Instr *next = instr->next, *i = next; i; i = next) {
+Instr *lastInstr(const InstrList *list) { return list->last; }
+
+void instrRollback(InstrList *list, Instr *checkpoint) {
+  Instr *i = checkpoint ? checkpoint->next : list->first;
+  for (Instr *next; i; i = next) {
     next = i->next;
     free(i);
   }
-  instr->next = NULL;
-}
-
-Instr *lastInstr(Instr *list) {
-  if (list) {
-    while (list->next)
-      list = list->next;
+  if (checkpoint) {
+    checkpoint->next = NULL;
+  } else {
+    list->first = NULL;
   }
-  return list;
+  list->last = checkpoint;
 }
 
-Instr *addInstrWithInt(Instr **list, Opcode op, int argVal) {
+Instr *addInstrWithInt(InstrList *list, Opcode op, int argVal) {
   Instr *i = addInstr(list, op);
   i->arg.i = argVal;
   return i;
 }
 
-Instr *addInstrWithDouble(Instr **list, Opcode op, double argVal) {
+Instr *addInstrWithDouble(InstrList *list, Opcode op, double argVal) {
   Instr *i = addInstr(list, op);
   i->arg.f = argVal;
   return i;
@@ -115,8 +115,8 @@ void *popp() {
 void put_i() { printf("=> %d", popi()); }
 
 void vmInit() {
-  Symbol *fn = addExtFn("put_i", put_i, (Type){TB_VOID, NULL, -1});
-  addFnParam(fn, "i", (Type){TB_INT, NULL, -1});
+  Symbol *fn = addExtFn(internStr("put_i"), put_i, (Type){TB_VOID, NULL, -1});
+  addFnParam(fn, internStr("i"), (Type){TB_INT, NULL, -1});
 }
 
 void run(Instr *IP) {
@@ -216,6 +216,12 @@ void run(Instr *IP) {
       pushf(IP->arg.f);
       IP = IP->next;
       break;
+    case OP_ADDR:
+      pTop = globalsMem + IP->arg.i;
+      pushp(pTop);
+      printf("ADDR\t%d\t// %p", IP->arg.i, pTop);
+      IP = IP->next;
+      break;
     case OP_FPADDR_I:
       pTop = &FP[IP->arg.i].i;
       pushp(pTop);
@@ -281,7 +287,7 @@ void f(int n){		// stack frame: n[-2] ret[-1] oldFP[0] i[1]
         }
 */
 Instr *genTestProgram() {
-  Instr *code = NULL;
+  InstrList code = {NULL, NULL};
   addInstrWithInt(&code, OP_PUSH_I, 2);
   Instr *callPos = addInstr(&code, OP_CALL);
   addInstr(&code, OP_HALT);
@@ -296,7 +302,7 @@ Instr *genTestProgram() {
   Instr *jfAfter = addInstr(&code, OP_JF);
   // put_i(i);
   addInstrWithInt(&code, OP_FPLOAD, 1);
-  Symbol *s = findSymbol("put_i");
+  Symbol *s = findSymbol(internStr("put_i"));
   if (!s)
     throwError("undefined: put_i");
   addInstr(&code, OP_CALL_EXT)->arg.extFnPtr = s->fn.extFnPtr;
@@ -309,5 +315,5 @@ Instr *genTestProgram() {
   addInstr(&code, OP_JMP)->arg.instr = whilePos;
   // returns from function
   jfAfter->arg.instr = addInstrWithInt(&code, OP_RET_VOID, 1);
-  return code;
+  return code.first;
 }
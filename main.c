@@ -1,32 +1,178 @@
 #include "ad.h"
+#include "intern.h"
 #include "lexer.h"
 #include "parser.h"
+#include "tokcache.h"
 #include "utils.h"
 #include "vm.h"
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// prints the errors from the last parse
+void printDiagnostics() {
+  for (int i = 0; i < nDiagnostics; i++) {
+    fprintf(stderr, "error in line %d: %s\n", diagnostics[i].line,
+            diagnostics[i].text);
+  }
+  if (nDiagnostics == MAX_DIAGNOSTICS) {
+    fprintf(stderr, "too many errors, the parsing was stopped\n");
+  }
+}
+
+// prints the errors from the last parse and exits
+void showDiagnostics() {
+  printDiagnostics();
+  exit(EXIT_FAILURE);
+}
+
+#define WATCH_INTERVAL_MS 100 // how often the watched file is checked
+
+// compiles path each time it changes, until the program is stopped
+// only the changed function bodies are compiled again, see reparse
+void watchFile(const char *path, int jobs) {
+  FileStamp stamp = {-1, -1};
+  Token *tokens = NULL;
+  for (;;) {
+    FileStamp crt = fileStamp(path);
+    if (crt.mtime < 0 || (crt.mtime == stamp.mtime && crt.size == stamp.size)) {
+      sleepMs(WATCH_INTERVAL_MS);
+      continue;
+    }
+    stamp = crt;
+    struct timespec start, end;
+    timespec_get(&start, TIME_UTC);
+    // the file is loaded, not mapped, because it can be changed meanwhile
+    char *file_data = loadFile(path);
+    Token *newTokens = tokenizeParallel(file_data, strlen(file_data), jobs);
+    free(file_data);
+    int nCompiled;
+    bool parsed = reparse(newTokens, jobs, &nCompiled);
+    timespec_get(&end, TIME_UTC);
+    double ms = (end.tv_sec - start.tv_sec) * 1e3 +
+                (end.tv_nsec - start.tv_nsec) / 1e6;
+    // reparse keeps the new tokens
+    if (tokens) {
+      freeTokens(tokens);
+    }
+    tokens = newTokens;
+    if (parsed) {
+      printf("%s: compiled %d function bodies in %.2f ms\n", path, nCompiled,
+             ms);
+    } else {
+      printDiagnostics();
+    }
+    fflush(stdout);
+  }
+}
+
+#define USAGE                                                                  \
+  "Usage ./translator [--stream | --jobs <n>] "                                \
+  "[--cache <dir> [--verify-cache] | --watch] <file_path | ->"
 
 int main(int argc, char *argv[]) {
-  if (argc != 2) {
-    throwError("Usage ./ALEX <file_path>");
+  // --stream lexes the input in chunks while parsing, instead of loading it
+  // all in memory; "-" reads the input from stdin, which is always streamed
+  // --jobs lexes an input loaded in memory and compiles its function bodies
+  // on up to n threads, so it cannot be used with a streamed input
+  // --cache keeps the tokens of the inputs loaded in memory in dir, so an
+  // unchanged input is not lexed again; --verify-cache lexes the input anyway
+  // and checks that the cached tokens are the same
+  // --watch compiles the input again each time it changes and prints how
+  // long it took, without running it; a lexical error stops the watch
+  bool stream = false;
+  int jobs = 1;
+  bool jobsSet = false;
+  const char *cacheDir = NULL;
+  bool verifyCache = false;
+  bool watch = false;
+  const char *path = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--stream") == 0) {
+      stream = true;
+    } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+      jobs = atoi(argv[++i]);
+      jobsSet = true;
+      if (jobs < 1) {
+        throwError(USAGE);
+      }
+    } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+      cacheDir = argv[++i];
+    } else if (strcmp(argv[i], "--verify-cache") == 0) {
+      verifyCache = true;
+    } else if (strcmp(argv[i], "--watch") == 0) {
+      watch = true;
+    } else if (!path) {
+      path = argv[i];
+    } else {
+      throwError(USAGE);
+    }
   }
-  char *file_data = loadFile(argv[1]);
-  Token *tokens = tokenize(file_data);
-  // showTokens(tokens);
+  if (!path || (verifyCache && !cacheDir)) {
+    throwError(USAGE);
+  }
+  if (strcmp(path, "-") == 0) {
+    stream = true;
+  }
+  if (stream && jobsSet) {
+    throwError(USAGE);
+  }
+  if (watch && (stream || cacheDir)) {
+    throwError(USAGE);
+  }
+
   pushDomain();
   vmInit();
-  parse(tokens);
+  if (watch) {
+    watchFile(path, jobs);
+  }
+  if (stream) {
+    FILE *fis = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (!fis) {
+      throwError("Unable to open %s", path);
+    }
+    Lexer *lexer = lexerOpen(fis);
+    bool parsed = parseStream(lexer);
+    lexerClose(lexer);
+    if (fis != stdin) {
+      fclose(fis);
+    }
+    if (!parsed) {
+      showDiagnostics();
+    }
+  } else {
+    size_t file_size;
+    const char *file_data = mapFile(path, &file_size);
+    Token *tokens;
+    if (cacheDir) {
+      tokens = tokenizeCached(file_data, cacheDir, jobs, verifyCache);
+    } else if (jobs > 1) {
+      tokens = tokenizeParallel(file_data, file_size, jobs);
+    } else {
+      tokens = tokenize(file_data);
+    }
+    // the tokens don't point in the source, so it can be released
+    unmapFile(file_data, file_size);
+    // showTokens(tokens);
+    bool parsed = parseParallel(tokens, jobs);
+    freeTokens(tokens);
+    if (!parsed) {
+      showDiagnostics();
+    }
+  }
 
-  Symbol *symMain = findSymbolInDomain(symTable, "main");
+  Symbol *symMain = findSymbolInDomain(symTable, internStr("main"));
   if (!symMain) {
     throwError("Missing main function\n");
   }
-  Instr *entryCode = NULL;
-  addInstr(&entryCode, OP_CALL)->arg.instr = symMain->fn.instr;
+  InstrList entryCode = {NULL, NULL};
+  addInstr(&entryCode, OP_CALL)->arg.instr = symMain->fn.instr.first;
   addInstr(&entryCode, OP_HALT);
-  run(entryCode);
+  run(entryCode.first);
 
   // showDomain(symTable, "Global");
   dropDomain();
   return 0;
-}
\ No newline at end of file
+}